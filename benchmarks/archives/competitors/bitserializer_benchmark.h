@@ -3,6 +3,8 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <algorithm>
+
 // Benchmark headers
 #include "benchmark_base.h"
 
@@ -66,43 +68,35 @@ class CBitSerializerBenchmark final : public CBenchmarkBase
 public:
 	CBitSerializerBenchmark()
 	{
-		if constexpr (BitSerializer::is_archive_support_output_data_type_v<typename TArchive::output_archive_type, std::string>)
-		{
-			mSupportedStagesList.push_back(TestStage::SaveToMemory);
-		}
-		if constexpr (BitSerializer::is_archive_support_input_data_type_v<typename TArchive::input_archive_type, std::string_view>)
-		{
-			mSupportedStagesList.push_back(TestStage::LoadFromMemory);
-		}
+		InitSupportedStages();
+	}
 
-		if constexpr (BitSerializer::is_archive_support_output_data_type_v<typename TArchive::output_archive_type, std::ostream>)
-		{
-			mSupportedStagesList.push_back(TestStage::SaveToStream);
-		}
-		if constexpr (BitSerializer::is_archive_support_input_data_type_v<typename TArchive::input_archive_type, std::istream>)
+	/**
+	 * @brief Constructs a benchmark variant with custom serialization options.
+	 *
+	 * @param serializationOptions Options passed to the save/load functions.
+	 * @param variantName Name which is appended to the library name.
+	 * @param stagesList Stages to run (unsupported ones are skipped).
+	 */
+	CBitSerializerBenchmark(const BitSerializer::SerializationOptions& serializationOptions, std::string variantName,
+		const std::vector<TestStage>& stagesList)
+		: mSerializationOptions(serializationOptions)
+		, mVariantName(std::move(variantName))
+	{
+		InitSupportedStages();
+		std::vector<TestStage> supportedStagesList;
+		for (const auto testStage : stagesList)
 		{
-			mSupportedStagesList.push_back(TestStage::LoadFromStream);
+			if (std::find(mSupportedStagesList.cbegin(), mSupportedStagesList.cend(), testStage) != mSupportedStagesList.cend()) {
+				supportedStagesList.push_back(testStage);
+			}
 		}
+		mSupportedStagesList = std::move(supportedStagesList);
 	}
 
 	[[nodiscard]] std::string GetLibraryName() const override
 	{
-#ifdef RAPIDJSON_BENCHMARK
-		if constexpr (std::is_same_v<TArchive, BitSerializer::Json::RapidJson::JsonArchive>) {
-			return "BitSerializer-RapidJson";
-		}
-#endif
-#ifdef PUGIXML_BENCHMARK
-		if constexpr (std::is_same_v<TArchive, BitSerializer::Xml::PugiXml::XmlArchive>) {
-			return "BitSerializer-PugiXml";
-		}
-#endif
-#ifdef RAPIDYAML_BENCHMARK
-		if constexpr (std::is_same_v<TArchive, BitSerializer::Yaml::RapidYaml::YamlArchive>) {
-			return "BitSerializer-RapidYaml";
-		}
-#endif
-		return "BitSerializer-" + BitSerializer::Convert::ToString(TArchive::archive_type);
+		return mVariantName.empty() ? GetBaseLibraryName() : GetBaseLibraryName() + " (" + mVariantName + ")";
 	}
 
 	std::vector<TestStage> GetStagesList() const override
@@ -113,9 +107,9 @@ public:
 protected:
 	void BenchmarkSaveToMemory(const CCommonTestModel& sourceTestModel, std::string& outputData) override
 	{
-		if constexpr (BitSerializer::is_archive_support_output_data_type_v<typename TArchive::output_archive_type, std::string>)
+		if constexpr (BitSerializer::is_archive_support_output_data_type_v<BitSerializer::select_output_archive_t<TArchive, std::string>, std::string>)
 		{
-			BitSerializer::SaveObject<TArchive>(sourceTestModel, outputData);
+			BitSerializer::SaveObject<TArchive>(sourceTestModel, outputData, mSerializationOptions);
 		}
 		else
 		{
@@ -125,9 +119,9 @@ protected:
 
 	void BenchmarkLoadFromMemory(CCommonTestModel& targetTestModel, const std::string& sourceData) override
 	{
-		if constexpr (BitSerializer::is_archive_support_input_data_type_v<typename TArchive::input_archive_type, std::string_view>)
+		if constexpr (BitSerializer::is_archive_support_input_data_type_v<BitSerializer::select_input_archive_t<TArchive, std::string_view>, std::string_view>)
 		{
-			BitSerializer::LoadObject<TArchive>(targetTestModel, sourceData);
+			BitSerializer::LoadObject<TArchive>(targetTestModel, sourceData, mSerializationOptions);
 		}
 		else
 		{
@@ -137,9 +131,9 @@ protected:
 
 	void BenchmarkSaveToStream(const CCommonTestModel& sourceTestModel, std::ostream& outputStream) override
 	{
-		if constexpr (BitSerializer::is_archive_support_output_data_type_v<typename TArchive::output_archive_type, std::ostream>)
+		if constexpr (BitSerializer::is_archive_support_output_data_type_v<BitSerializer::select_output_archive_t<TArchive, std::ostream>, std::ostream>)
 		{
-			BitSerializer::SaveObject<TArchive>(sourceTestModel, outputStream);
+			BitSerializer::SaveObject<TArchive>(sourceTestModel, outputStream, mSerializationOptions);
 		}
 		else
 		{
@@ -149,9 +143,9 @@ protected:
 
 	void BenchmarkLoadFromStream(CCommonTestModel& targetTestModel, std::istream& inputStream) override
 	{
-		if constexpr (BitSerializer::is_archive_support_input_data_type_v<typename TArchive::input_archive_type, std::istream>)
+		if constexpr (BitSerializer::is_archive_support_input_data_type_v<BitSerializer::select_input_archive_t<TArchive, std::istream>, std::istream>)
 		{
-			BitSerializer::LoadObject<TArchive>(targetTestModel, inputStream);
+			BitSerializer::LoadObject<TArchive>(targetTestModel, inputStream, mSerializationOptions);
 		}
 		else
 		{
@@ -160,7 +154,50 @@ protected:
 	}
 
 private:
+	void InitSupportedStages()
+	{
+		if constexpr (BitSerializer::is_archive_support_output_data_type_v<BitSerializer::select_output_archive_t<TArchive, std::string>, std::string>)
+		{
+			mSupportedStagesList.push_back(TestStage::SaveToMemory);
+		}
+		if constexpr (BitSerializer::is_archive_support_input_data_type_v<BitSerializer::select_input_archive_t<TArchive, std::string_view>, std::string_view>)
+		{
+			mSupportedStagesList.push_back(TestStage::LoadFromMemory);
+		}
+
+		if constexpr (BitSerializer::is_archive_support_output_data_type_v<BitSerializer::select_output_archive_t<TArchive, std::ostream>, std::ostream>)
+		{
+			mSupportedStagesList.push_back(TestStage::SaveToStream);
+		}
+		if constexpr (BitSerializer::is_archive_support_input_data_type_v<BitSerializer::select_input_archive_t<TArchive, std::istream>, std::istream>)
+		{
+			mSupportedStagesList.push_back(TestStage::LoadFromStream);
+		}
+	}
+
+	[[nodiscard]] std::string GetBaseLibraryName() const
+	{
+#ifdef RAPIDJSON_BENCHMARK
+		if constexpr (std::is_same_v<TArchive, BitSerializer::Json::RapidJson::JsonArchive>) {
+			return "BitSerializer-RapidJson";
+		}
+#endif
+#ifdef PUGIXML_BENCHMARK
+		if constexpr (std::is_same_v<TArchive, BitSerializer::Xml::PugiXml::XmlArchive>) {
+			return "BitSerializer-PugiXml";
+		}
+#endif
+#ifdef RAPIDYAML_BENCHMARK
+		if constexpr (std::is_same_v<TArchive, BitSerializer::Yaml::RapidYaml::YamlArchive>) {
+			return "BitSerializer-RapidYaml";
+		}
+#endif
+		return "BitSerializer-" + BitSerializer::Convert::ToString(TArchive::archive_type);
+	}
+
 	std::vector<TestStage> mSupportedStagesList;
+	BitSerializer::SerializationOptions mSerializationOptions;
+	std::string mVariantName;
 };
 
 #pragma warning(pop)
@@ -56,6 +56,21 @@ int main()	// NOLINT(bugprone-exception-escape)
 #ifdef MSGPACK_BENCHMARK
 		CBitSerializerBenchmark<BitSerializer::MsgPack::MsgPackArchive> msgPackBenchmark;
 		benchmarkResults.push_back(msgPackBenchmark.RunBenchmark(DefaultStageTestTime));
+
+		// Loading from stream with different sizes of read-ahead buffer (the results are printed only to the console)
+		const std::pair<size_t, bool> readBufferVariants[] = {
+			{ 256, false }, { 8 * 1024, false }, { 64 * 1024, false }, { 256, true }
+		};
+		for (const auto& [readBufferSize, growReadBuffer] : readBufferVariants)
+		{
+			BitSerializer::SerializationOptions serializationOptions;
+			serializationOptions.streamOptions.readBufferSize = readBufferSize;
+			serializationOptions.streamOptions.growReadBuffer = growReadBuffer;
+			const std::string variantName = "read buffer " + std::to_string(readBufferSize) + (growReadBuffer ? " + grow" : "");
+			CBitSerializerBenchmark<BitSerializer::MsgPack::MsgPackArchive> msgPackReadBufferBenchmark(serializationOptions,
+				variantName, { TestStage::LoadFromStream });
+			msgPackReadBufferBenchmark.RunBenchmark(DefaultStageTestTime);
+		}
 #endif
 #ifdef RAPIDJSON_BENCHMARK
 		CBitSerializerBenchmark<BitSerializer::Json::RapidJson::JsonArchive> bitSerializerRapidJsonBenchmark;
@@ -4,6 +4,12 @@
 *******************************************************************************/
 #pragma once
 #include <fstream>
+#include "bitserializer/common/fixed_output_buffer.h"
+#include "bitserializer/common/mapped_file.h"
+#include "bitserializer/common/output_string_ref.h"
+#if BITSERIALIZER_HAS_MAPPED_FILES
+#include <filesystem>
+#endif
 #include "bitserializer/serialization_detail/serialization_base_types.h"
 #include "bitserializer/serialization_detail/key_value_proxy.h"
 #include "bitserializer/serialization_detail/serialization_context.h"
@@ -33,13 +39,14 @@ namespace BitSerializer
 	template <typename TArchive, typename TValue, typename TInput, std::enable_if_t<!is_input_stream_v<TInput>, int> = 0>
 	static void LoadObject(TValue&& object, const TInput& input, const SerializationOptions& options = DefaultOptions)
 	{
-		constexpr auto hasInputDataTypeSupport = is_archive_support_input_data_type_v<typename TArchive::input_archive_type, TInput>;
+		using input_archive_type = select_input_archive_t<TArchive, TInput>;
+		constexpr auto hasInputDataTypeSupport = is_archive_support_input_data_type_v<input_archive_type, TInput>;
 		static_assert(hasInputDataTypeSupport, "BitSerializer. The archive does not support loading from the provided data type.");
 
 		if constexpr (hasInputDataTypeSupport)
 		{
 			SerializationContext context(options);
-			typename TArchive::input_archive_type archive(input, context);
+			input_archive_type archive(input, context);
 			KeyValueProxy::SplitAndSerialize(archive, std::forward<TValue>(object));
 			archive.Finalize();
 			context.OnFinishSerialization();
@@ -59,25 +66,69 @@ namespace BitSerializer
 	template <typename TArchive, typename TValue, typename TStreamElem>
 	static void LoadObject(TValue&& object, std::basic_istream<TStreamElem, std::char_traits<TStreamElem>>& input, const SerializationOptions& options = DefaultOptions)
 	{
-		constexpr auto hasInputDataTypeSupport = is_archive_support_input_data_type_v<typename TArchive::input_archive_type, std::basic_istream<TStreamElem, std::char_traits<TStreamElem>>>;
+		using input_stream_type = std::basic_istream<TStreamElem, std::char_traits<TStreamElem>>;
+		using input_archive_type = select_input_archive_t<TArchive, input_stream_type>;
+		constexpr auto hasInputDataTypeSupport = is_archive_support_input_data_type_v<input_archive_type, input_stream_type>;
 		static_assert(hasInputDataTypeSupport, "BitSerializer. The archive does not support loading from the provided stream type.");
 
 		if constexpr (hasInputDataTypeSupport)
 		{
 			SerializationContext context(options);
-			typename TArchive::input_archive_type archive(input, context);
+			input_archive_type archive(input, context);
 			KeyValueProxy::SplitAndSerialize(archive, std::forward<TValue>(object));
 			archive.Finalize();
 			context.OnFinishSerialization();
 		}
 	}
 
+	namespace Detail
+	{
+		/**
+		 * @brief Measures the size of data in the passed serialization context (see `MeasureObject()`).
+		 */
+		template <typename TArchive, typename TValue>
+		size_t MeasureObject(TValue&& object, SerializationContext& context)
+		{
+			size_t size = 0;
+			typename TArchive::measure_archive_type archive(size, context);
+			KeyValueProxy::SplitAndSerialize(archive, std::forward<TValue>(object));
+			archive.Finalize();
+			return size;
+		}
+	}
+
+	/**
+	 * @brief Measures the exact size of data which will be produced by saving an object to the string (without encoding it).
+	 *
+	 * @tparam TArchive   The archive type that supports measuring (currently only MsgPackArchive).
+	 * @tparam TValue     The type of the object to be measured.
+	 * @param[in] object  The object to be measured.
+	 * @param[in] options The serialization options (should be the same as for saving).
+	 * @return The size of data in bytes.
+	 */
+	template <typename TArchive, typename TValue>
+	static size_t MeasureObject(TValue&& object, const SerializationOptions& options = DefaultOptions)
+	{
+		constexpr auto hasMeasureSupport = is_archive_support_measure_v<TArchive>;
+		static_assert(hasMeasureSupport, "BitSerializer. The archive does not support measuring the size of output data.");
+
+		size_t size = 0;
+		if constexpr (hasMeasureSupport)
+		{
+			SerializationContext context(options);
+			size = Detail::MeasureObject<TArchive>(std::forward<TValue>(object), context);
+			context.OnFinishSerialization();
+		}
+		return size;
+	}
+
 	/**
 	 * @brief Saves an object to a supported data type (UTF-8 string or binary array depending on archive type).
 	 *
 	 * @tparam TArchive   The archive type that handles serialization/deserialization (e.g. JsonArchive, MsgPackArchive).
 	 * @tparam TValue     The type of the object to be serialized.
-	 * @tparam TOutput    The type of the output data (currently supported only `std::string`).
+	 * @tparam TOutput    The type of the output data (`std::string`, strings with custom allocators like `std::pmr::string`
+	 *                    for MsgPack, CSV and JSON archives, or `FixedOutputBuffer` for MsgPack and CSV archives).
 	 * @param[in] object  The object to be serialized.
 	 * @param[out] output The destination for the serialized data.
 	 * @param[in] options The serialization options.
@@ -85,19 +136,50 @@ namespace BitSerializer
 	template <typename TArchive, typename TValue, typename TOutput, std::enable_if_t<!is_output_stream_v<TOutput>, int> = 0>
 	static void SaveObject(TValue&& object, TOutput& output, const SerializationOptions& options = DefaultOptions)
 	{
-		constexpr auto hasOutputDataTypeSupport = is_archive_support_output_data_type_v<typename TArchive::output_archive_type, TOutput>;
+		using output_archive_type = select_output_archive_t<TArchive, TOutput>;
+		constexpr auto hasOutputDataTypeSupport = is_archive_support_output_data_type_v<output_archive_type, TOutput>;
 		static_assert(hasOutputDataTypeSupport, "BitSerializer. The archive does not support saving to the provided data type.");
 
 		if constexpr (hasOutputDataTypeSupport)
 		{
 			SerializationContext context(options);
-			typename TArchive::output_archive_type archive(output, context);
+			if constexpr (is_archive_support_measure_v<TArchive> && is_output_char_string_v<TOutput>)
+			{
+				// The context is shared with the saving pass (it can use the layout counted while measuring)
+				if (options.reserveExactSize) {
+					output.reserve(output.size() + Detail::MeasureObject<TArchive>(object, context));
+				}
+			}
+
+			output_archive_type archive(output, context);
 			KeyValueProxy::SplitAndSerialize(archive, std::forward<TValue>(object));
 			archive.Finalize();
 			context.OnFinishSerialization();
 		}
 	}
 
+	/**
+	 * @brief Saves an object to the buffer provided by caller (e.g. preallocated network buffer), nothing is allocated for output data.
+	 *
+	 * Like `snprintf()`, returns the size of whole data. When it is greater than `capacity`, the buffer is overflowed
+	 * (contains incomplete data) and the returned size can be used to prepare the buffer of sufficient size.
+	 *
+	 * @tparam TArchive    The archive type that supports saving to `FixedOutputBuffer` (MsgPackArchive, CsvArchive).
+	 * @tparam TValue      The type of the object to be serialized.
+	 * @param[in] object   The object to be serialized.
+	 * @param[out] data    The destination buffer.
+	 * @param[in] capacity The size of destination buffer.
+	 * @param[in] options  The serialization options.
+	 * @return The number of written bytes, or the required size of buffer when it is greater than `capacity`.
+	 */
+	template <typename TArchive, typename TValue>
+	static size_t SaveObject(TValue&& object, char* data, size_t capacity, const SerializationOptions& options = DefaultOptions)
+	{
+		FixedOutputBuffer output(data, capacity);
+		SaveObject<TArchive>(std::forward<TValue>(object), output, options);
+		return output.size();
+	}
+
 	/**
 	 * @brief Saves an object to a stream (e.g., file or network stream).
 	 *
@@ -111,13 +193,15 @@ namespace BitSerializer
 	template <typename TArchive, typename TValue, typename TStreamElem>
 	static void SaveObject(TValue&& object, std::basic_ostream<TStreamElem, std::char_traits<TStreamElem>>& output, const SerializationOptions& options = DefaultOptions)
 	{
-		constexpr auto hasOutputDataTypeSupport = is_archive_support_output_data_type_v<typename TArchive::output_archive_type, std::basic_ostream<TStreamElem, std::char_traits<TStreamElem>>>;
+		using output_stream_type = std::basic_ostream<TStreamElem, std::char_traits<TStreamElem>>;
+		using output_archive_type = select_output_archive_t<TArchive, output_stream_type>;
+		constexpr auto hasOutputDataTypeSupport = is_archive_support_output_data_type_v<output_archive_type, output_stream_type>;
 		static_assert(hasOutputDataTypeSupport, "BitSerializer. The archive does not support saving to the provided stream type.");
 
 		if constexpr (hasOutputDataTypeSupport)
 		{
 			SerializationContext context(options);
-			typename TArchive::output_archive_type archive(output, context);
+			output_archive_type archive(output, context);
 			KeyValueProxy::SplitAndSerialize(archive, std::forward<TValue>(object));
 			archive.Finalize();
 			context.OnFinishSerialization();
@@ -137,7 +221,7 @@ namespace BitSerializer
 	template <typename TArchive, typename TValue, typename TOutput = typename TArchive::preferred_output_format>
 	static TOutput SaveObject(TValue&& object, const SerializationOptions& options = DefaultOptions)
 	{
-		typename TArchive::preferred_output_format output;
+		TOutput output;
 		SaveObject<TArchive>(std::forward<TValue>(object), output, options);
 		return output;
 	}
@@ -147,6 +231,10 @@ namespace BitSerializer
 	/**
 	 * @brief Loads an object from a file.
 	 *
+	 * On Linux, the file is mapped into memory and loaded like from `std::string_view` (when supported by archive),
+	 * otherwise it is read via the file stream. The mapped file must not be truncated by other processes while
+	 * loading, as access to the truncated part raises the `SIGBUS` signal.
+	 *
 	 * @tparam TArchive   The archive type that handles serialization/deserialization (e.g. JsonArchive, MsgPackArchive).
 	 * @tparam TValue     The type of the object to be deserialized.
 	 * @tparam TPath      The type of the file path (e.g., std::filesystem::path, std::string, const char*).
@@ -157,6 +245,35 @@ namespace BitSerializer
 	template <typename TArchive, typename TValue, typename TPath>
 	static void LoadObjectFromFile(TValue&& object, TPath&& path, const SerializationOptions& options = DefaultOptions)
 	{
+#if BITSERIALIZER_HAS_MAPPED_FILES
+		// Load from the memory-mapped file when the archive supports loading from `std::string_view` (faster than via stream)
+		if constexpr (is_archive_support_mapped_files_v<TArchive> &&
+			is_archive_support_input_data_type_v<select_input_archive_t<TArchive, std::string_view>, std::string_view>)
+		{
+			Detail::CMappedFile mappedFile;
+			if (mappedFile.Open(std::filesystem::path(path).c_str()))
+			{
+				std::string_view data = mappedFile.GetData();
+				if constexpr (TArchive::is_binary)
+				{
+					LoadObject<TArchive>(std::forward<TValue>(object), data, options);
+					return;
+				}
+				else
+				{
+					// Text archives are loaded from memory only in UTF-8 (other encodings are decoded by stream readers)
+					static constexpr size_t maxSizeToDetectEncoding = 128;
+					size_t dataOffset = 0;
+					if (Convert::Utf::DetectEncoding(data.substr(0, maxSizeToDetectEncoding), dataOffset) == Convert::Utf::UtfType::Utf8)
+					{
+						LoadObject<TArchive>(std::forward<TValue>(object), data.substr(dataOffset), options);
+						return;
+					}
+				}
+			}
+		}
+#endif
+
 		using preferred_stream_char_type = typename TArchive::preferred_stream_char_type;
 		std::basic_ifstream<preferred_stream_char_type> stream;
 		stream.open(std::forward<TPath>(path), std::ifstream::in | std::ifstream::binary);
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace BitSerializer
+{
+	/**
+	 * @brief Output buffer with fixed capacity provided by the caller (e.g. preallocated network buffer).
+	 *
+	 * Nothing is allocated when saving to this buffer. When data does not fit, the writing is stopped, but the size
+	 * continues to be counted, so after saving, `size()` returns the required size of buffer (see `overflowed()`).
+	 * Has the subset of `std::string` interface, which is used by writers of archives.
+	 */
+	class FixedOutputBuffer
+	{
+	public:
+		FixedOutputBuffer(char* data, size_t capacity) noexcept
+			: mData(data)
+			, mCapacity(capacity)
+		{ }
+
+		template <size_t N>
+		explicit FixedOutputBuffer(char(&data)[N]) noexcept
+			: FixedOutputBuffer(data, N)
+		{ }
+
+		[[nodiscard]] char* data() const noexcept { return mData; }
+		[[nodiscard]] size_t capacity() const noexcept { return mCapacity; }
+
+		/**
+		 * @brief Returns the size of written data, or the required size of buffer when it is overflowed.
+		 */
+		[[nodiscard]] size_t size() const noexcept { return mSize; }
+		[[nodiscard]] bool empty() const noexcept { return mSize == 0; }
+
+		/**
+		 * @brief Returns `true` when the data did not fit into the buffer (the content of buffer is incomplete).
+		 */
+		[[nodiscard]] bool overflowed() const noexcept { return mSize > mCapacity; }
+
+		/**
+		 * @brief Returns the written data (empty when the buffer is overflowed).
+		 */
+		[[nodiscard]] std::string_view view() const noexcept
+		{
+			return overflowed() ? std::string_view() : std::string_view(mData, mSize);
+		}
+
+		void clear() noexcept { mSize = 0; }
+
+		void push_back(char ch) noexcept
+		{
+			if (mSize < mCapacity) {
+				mData[mSize] = ch;
+			}
+			++mSize;
+		}
+
+		void append(const char* data, size_t size) noexcept
+		{
+			if (size <= mCapacity && mSize <= mCapacity - size) {
+				std::memcpy(mData + mSize, data, size);
+			}
+			mSize += size;
+		}
+
+		void append(std::string_view str) noexcept
+		{
+			append(str.data(), str.size());
+		}
+
+		/**
+		 * @brief Changes the size of data, new bytes are not initialized (they should be written via `data()`).
+		 */
+		void resize(size_t size) noexcept { mSize = size; }
+
+		/**
+		 * @brief Replaces `count` bytes at `pos` by the passed data (the tail is moved when sizes are different).
+		 */
+		void replace(size_t pos, size_t count, const char* data, size_t size) noexcept
+		{
+			const size_t newSize = mSize - count + size;
+			if (!overflowed() && newSize <= mCapacity)
+			{
+				std::memmove(mData + pos + size, mData + pos + count, mSize - pos - count);
+				std::memcpy(mData + pos, data, size);
+			}
+			mSize = newSize;
+		}
+
+	private:
+		char* mData;
+		size_t mCapacity;
+		size_t mSize = 0;
+	};
+}
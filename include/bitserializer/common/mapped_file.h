@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include "bitserializer/export.h"
+
+#if defined(__linux__) && !defined(BITSERIALIZER_DISABLE_MAPPED_FILES)
+#define BITSERIALIZER_HAS_MAPPED_FILES 1
+#else
+#define BITSERIALIZER_HAS_MAPPED_FILES 0
+#endif
+
+namespace BitSerializer::Detail
+{
+	/**
+	 * @brief Read-only view of a file mapped into memory.
+	 *
+	 * Only regular non-empty files can be mapped, the method `Open()` returns `false` in other cases (and on platforms
+	 * without support of memory-mapped files), so the caller should fall back to the reading via streams.
+	 * The implementation is compiled into archives which are built as libraries (system headers do not leak to users).
+	 *
+	 * Note: the file must not be truncated while it is mapped, access to the pages beyond the new end of file
+	 * raises the `SIGBUS` signal (the memory is not copied, so such changes are not detected by the mapping).
+	 */
+	class BITSERIALIZER_API CMappedFile
+	{
+	public:
+		CMappedFile() = default;
+		~CMappedFile() {
+			Close();
+		}
+
+		CMappedFile(const CMappedFile&) = delete;
+		CMappedFile& operator=(const CMappedFile&) = delete;
+
+		/**
+		 * @brief Maps the file into memory (the previously mapped file will be closed).
+		 *
+		 * @param path Path to the file.
+		 * @return `true` when the file has been mapped.
+		 */
+		bool Open(const char* path) noexcept;
+
+		/**
+		 * @brief Unmaps the file.
+		 */
+		void Close() noexcept;
+
+		[[nodiscard]] bool IsOpen() const noexcept {
+			return mData != nullptr;
+		}
+
+		/**
+		 * @brief Returns the content of the mapped file (valid until the file is closed).
+		 */
+		[[nodiscard]] std::string_view GetData() const noexcept {
+			return { mData, mSize };
+		}
+
+	private:
+		const char* mData = nullptr;
+		size_t mSize = 0;
+	};
+}
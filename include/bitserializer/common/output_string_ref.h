@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace BitSerializer
+{
+	/**
+	 * @brief Checks that type is a string of `char` with any allocator (e.g. `std::string`, `std::pmr::string`).
+	 */
+	template <typename T>
+	struct is_output_char_string : std::false_type {};
+
+	template <typename TAllocator>
+	struct is_output_char_string<std::basic_string<char, std::char_traits<char>, TAllocator>> : std::true_type {};
+
+	template <typename T>
+	constexpr bool is_output_char_string_v = is_output_char_string<T>::value;
+}
+
+namespace BitSerializer::Detail
+{
+	/**
+	 * @brief Type-erased reference to the output string with custom allocator (e.g. `std::pmr::string`).
+	 *
+	 * Allows the compiled writers of archives to save data directly into strings with any allocator.
+	 * Has the subset of `std::string` interface, which is used by writers of archives.
+	 *
+	 * Data is written directly into the memory of string (the string is resized to its capacity, which is the writable window),
+	 * the indirect call is made only when the window needs to grow. The string is truncated to the size of written data
+	 * when the reference is destroyed (so it can be only moved).
+	 */
+	class COutputStringRef
+	{
+	public:
+		template <typename TAllocator>
+		COutputStringRef(std::basic_string<char, std::char_traits<char>, TAllocator>& outputString) noexcept  // NOLINT(google-explicit-constructor)
+			: mString(&outputString)
+			, mOps(&StringOps<std::basic_string<char, std::char_traits<char>, TAllocator>>)
+			, mData(outputString.data())
+			, mSize(outputString.size())
+			, mCapacity(outputString.size())
+		{ }
+
+		COutputStringRef(COutputStringRef&& other) noexcept
+			: mString(std::exchange(other.mString, nullptr))
+			, mOps(other.mOps)
+			, mData(other.mData)
+			, mSize(other.mSize)
+			, mCapacity(other.mCapacity)
+		{ }
+
+		COutputStringRef(const COutputStringRef&) = delete;
+		COutputStringRef& operator=(const COutputStringRef&) = delete;
+		COutputStringRef& operator=(COutputStringRef&&) = delete;
+
+		~COutputStringRef()
+		{
+			if (mString) {
+				mOps->Resize(mString, mSize);
+			}
+		}
+
+		[[nodiscard]] char* data() const noexcept { return mData; }
+		[[nodiscard]] size_t size() const noexcept { return mSize; }
+		[[nodiscard]] size_t capacity() const noexcept { return mCapacity; }
+		[[nodiscard]] char& operator[](size_t pos) const noexcept { return mData[pos]; }
+
+		void reserve(size_t size)
+		{
+			if (size > mCapacity) {
+				Grow(size);
+			}
+		}
+
+		void resize(size_t size)
+		{
+			if (size > mCapacity) {
+				Grow((std::max)(size, mCapacity * 2));
+			}
+			mSize = size;
+		}
+
+		void clear() noexcept { mSize = 0; }
+
+		void push_back(char ch)
+		{
+			if (mSize == mCapacity) {
+				Grow((std::max)(mSize + 1, mCapacity * 2));
+			}
+			mData[mSize++] = ch;
+		}
+
+		void append(const char* data, size_t size)
+		{
+			if (size > mCapacity - mSize) {
+				Grow((std::max)(mSize + size, mCapacity * 2));
+			}
+			std::memcpy(mData + mSize, data, size);
+			mSize += size;
+		}
+
+		void append(std::string_view str) { append(str.data(), str.size()); }
+
+		void replace(size_t pos, size_t count, const char* data, size_t size)
+		{
+			if (size > count) {
+				reserve(mSize + size - count);
+			}
+			std::memmove(mData + pos + size, mData + pos + count, mSize - pos - count);
+			std::memcpy(mData + pos, data, size);
+			mSize = mSize - count + size;
+		}
+
+	private:
+		/**
+		 * @brief Grows the writable window (only this operation and the final truncation are called indirectly).
+		 */
+		void Grow(size_t minCapacity)
+		{
+			mData = mOps->Grow(mString, minCapacity, mCapacity);
+		}
+
+		struct Ops
+		{
+			char* (*Grow)(void* str, size_t minCapacity, size_t& capacity);
+			void (*Resize)(void* str, size_t size);
+		};
+
+		template <typename TString>
+		static constexpr Ops StringOps = {
+			[](void* str, size_t minCapacity, size_t& capacity)
+			{
+				// The whole capacity is made available for writing (the string is truncated when the writing is finished)
+				auto& outputString = *static_cast<TString*>(str);
+				outputString.reserve(minCapacity);
+				outputString.resize(outputString.capacity());
+				capacity = outputString.size();
+				return outputString.data();
+			},
+			[](void* str, size_t size) { static_cast<TString*>(str)->resize(size); }
+		};
+
+		void* mString;
+		const Ops* mOps;
+		char* mData;
+		size_t mSize;
+		size_t mCapacity;
+	};
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace BitSerializer
+{
+	/**
+	 * @brief Input data which is split into several segments (e.g. a message received into several network buffers).
+	 *
+	 * Only the pointer to the sequence of segments is stored, so the segments and their data must stay valid while loading.
+	 * Archives decode values directly from segments, a temporary copy is assembled only for values that straddle the boundary.
+	 */
+	class SegmentedInput
+	{
+	public:
+		SegmentedInput(const std::string_view* segments, size_t count) noexcept
+			: mSegments(segments)
+			, mCount(count)
+		{ }
+
+		/**
+		 * @brief Constructs from a contiguous container of `std::string_view` (e.g. `std::vector`, `std::array` or C-array).
+		 */
+		template <typename TContainer, std::enable_if_t<std::is_convertible_v<
+			decltype(std::data(std::declval<const TContainer&>())), const std::string_view*>, int> = 0>
+		explicit SegmentedInput(const TContainer& segments) noexcept
+			: SegmentedInput(std::data(segments), std::size(segments))
+		{ }
+
+		[[nodiscard]] const std::string_view* begin() const noexcept { return mSegments; }
+		[[nodiscard]] const std::string_view* end() const noexcept { return mSegments + mCount; }
+		[[nodiscard]] const std::string_view& operator[](size_t index) const noexcept { return mSegments[index]; }
+
+		/**
+		 * @brief Returns the number of segments.
+		 */
+		[[nodiscard]] size_t size() const noexcept { return mCount; }
+		[[nodiscard]] bool empty() const noexcept { return mCount == 0; }
+
+		/**
+		 * @brief Returns the total size of data in all segments.
+		 */
+		[[nodiscard]] size_t total_size() const noexcept
+		{
+			size_t totalSize = 0;
+			for (const auto& segment : *this) {
+				totalSize += segment.size();
+			}
+			return totalSize;
+		}
+
+	private:
+		const std::string_view* mSegments;
+		size_t mCount;
+	};
+}
@@ -8,6 +8,8 @@
 #include <string>
 #include <type_traits>
 #include "bitserializer/export.h"
+#include "bitserializer/common/fixed_output_buffer.h"
+#include "bitserializer/common/output_string_ref.h"
 #include "bitserializer/serialization_detail/archive_base.h"
 #include "bitserializer/serialization_detail/errors_handling.h"
 
@@ -28,6 +30,7 @@ struct CsvArchiveTraits  // NOLINT(cppcoreguidelines-special-member-functions)
 	using preferred_stream_char_type = char;
 	static constexpr char path_separator = '/';
 	static constexpr bool is_binary = false;
+	static constexpr bool support_mapped_files = true;
 
 	static constexpr char allowed_separators[] = { ',', ';', '\t', ' ', '|' };
 
@@ -151,6 +154,8 @@ class BITSERIALIZER_API CsvWriteRootScope final : public CsvArchiveTraits, publi
 public:
 	CsvWriteRootScope(std::string& encodedOutputStr, SerializationContext& serializationContext);
 	CsvWriteRootScope(std::ostream& outputStream, SerializationContext& serializationContext);
+	CsvWriteRootScope(FixedOutputBuffer& outputBuffer, SerializationContext& serializationContext);
+	CsvWriteRootScope(BitSerializer::Detail::COutputStringRef outputString, SerializationContext& serializationContext);
 	~CsvWriteRootScope();
 
 	CsvWriteRootScope(CsvWriteRootScope&&) = delete;
@@ -390,8 +395,9 @@ private:
  * @brief CSV archive.
  *
  * Supports load/save from:
- *  `std::string`: UTF-8
+ *  `std::string`: UTF-8 (save also to strings with custom allocators, e.g. `std::pmr::string`)
  *  `std::istream` and `std::ostream`: UTF-8, UTF-16LE, UTF-16BE, UTF-32LE, UTF-32BE
+ *  `FixedOutputBuffer`: UTF-8 (only save, the buffer with fixed capacity provided by caller)
  */
 using CsvArchive = TArchiveBase<
 	Detail::CsvArchiveTraits,
@@ -3,11 +3,32 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <cstdint>
 #include <tuple>
 #include <utility>
 
 namespace BitSerializer
 {
+	/**
+	 * @brief Declares the integer id of field, can be passed as extra parameter of `KeyValue`.
+	 *
+	 * Archives which support integer keys (like MsgPack) store the id instead of the name, that makes messages smaller
+	 * and keys are faster to compare. Other archives use the name, so the model remains the table of names and ids.
+	 *
+	 * Usage example:
+	 * @code
+	 * archive << KeyValue("price", Price, FieldId(1));
+	 * @endcode
+	 */
+	struct FieldId
+	{
+		constexpr explicit FieldId(uint32_t id) noexcept
+			: Id(id)
+		{ }
+
+		uint32_t Id;
+	};
+
 	/**
 	 * @brief A generic wrapper for a key-value pair with optional extra parameters.
 	 *
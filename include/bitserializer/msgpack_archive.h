@@ -3,20 +3,38 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
 #include <iosfwd>
+#include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 #include "bitserializer/export.h"
+#include "bitserializer/common/fixed_output_buffer.h"
+#include "bitserializer/common/memory.h"
+#include "bitserializer/common/output_string_ref.h"
+#include "bitserializer/common/segmented_input.h"
 #include "bitserializer/serialization_detail/archive_base.h"
 #include "bitserializer/serialization_detail/bin_timestamp.h"
 #include "bitserializer/serialization_detail/errors_handling.h"
 #include "bitserializer/serialization_detail/object_traits.h"
 
 
+namespace BitSerializer::Detail {
+	class CBinaryStreamReader;
+	class CBinarySegmentsReader;
+}
+
 namespace BitSerializer::MsgPack {
 namespace Detail {
 
 using BitSerializer::Detail::CBinTimestamp;
+using BitSerializer::Detail::COutputStringRef;
 
 /**
  * @brief MsgPack archive traits.
@@ -33,6 +51,7 @@ struct MsgPackArchiveTraits  // NOLINT(cppcoreguidelines-special-member-function
 	static constexpr bool is_binary = true;
 	static constexpr bool require_array_size = false;
 	static constexpr bool require_map_size = false;
+	static constexpr bool support_mapped_files = true;
 
 protected:
 	~MsgPackArchiveTraits() = default;
@@ -55,6 +74,119 @@ enum class ValueType
 	Timestamp
 };
 
+/**
+ * @brief Checks whether the arrays of numbers of this type can be written/read as a block (see `WriteValues()`/`ReadValues()`).
+ */
+template <typename T>
+constexpr bool is_block_number_v =
+	std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t> ||
+	std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> ||
+	std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/**
+ * @brief Code of the MsgPack extension type, which is used for storing typed arrays (see `SerializationOptions::useTypedArrays`).
+ *
+ * The data of extension starts with one byte of `TypedArrayItemType`, followed by items in little-endian byte order.
+ */
+constexpr char typed_array_ext_type = 0x10;
+
+/**
+ * @brief Type of items in the typed array (high 4 bits - kind of number, low 4 bits - log2 of size plus one).
+ */
+enum class TypedArrayItemType : uint8_t
+{
+	None = 0,
+	UInt8 = 0x01,
+	UInt16 = 0x02,
+	UInt32 = 0x03,
+	UInt64 = 0x04,
+	Int8 = 0x11,
+	Int16 = 0x12,
+	Int32 = 0x13,
+	Int64 = 0x14,
+	Float = 0x23,
+	Double = 0x24
+};
+
+template <typename T>
+constexpr TypedArrayItemType typed_array_item_type_v =
+	std::is_same_v<T, uint8_t> ? TypedArrayItemType::UInt8 :
+	std::is_same_v<T, uint16_t> ? TypedArrayItemType::UInt16 :
+	std::is_same_v<T, uint32_t> ? TypedArrayItemType::UInt32 :
+	std::is_same_v<T, uint64_t> ? TypedArrayItemType::UInt64 :
+	std::is_same_v<T, int8_t> ? TypedArrayItemType::Int8 :
+	std::is_same_v<T, int16_t> ? TypedArrayItemType::Int16 :
+	std::is_same_v<T, int32_t> ? TypedArrayItemType::Int32 :
+	std::is_same_v<T, int64_t> ? TypedArrayItemType::Int64 :
+	std::is_same_v<T, float> ? TypedArrayItemType::Float :
+	std::is_same_v<T, double> ? TypedArrayItemType::Double : TypedArrayItemType::None;
+
+/**
+ * @brief Returns the size of item in bytes (0 for unknown types).
+ */
+constexpr size_t GetTypedArrayItemSize(TypedArrayItemType itemType) noexcept
+{
+	switch (itemType)
+	{
+	case TypedArrayItemType::UInt8:
+	case TypedArrayItemType::UInt16:
+	case TypedArrayItemType::UInt32:
+	case TypedArrayItemType::UInt64:
+	case TypedArrayItemType::Int8:
+	case TypedArrayItemType::Int16:
+	case TypedArrayItemType::Int32:
+	case TypedArrayItemType::Int64:
+	case TypedArrayItemType::Float:
+	case TypedArrayItemType::Double:
+		return static_cast<size_t>(1) << ((static_cast<uint8_t>(itemType) & 0x0Fu) - 1);
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Writes items of typed array in little-endian byte order (the header should be written separately).
+ */
+template <typename T, class TWriter>
+void WriteTypedArrayItems(TWriter& msgPackWriter, const T* data, size_t size)
+{
+	if constexpr (sizeof(T) == 1 || Memory::Endian::native == Memory::Endian::little)
+	{
+		msgPackWriter.WriteBinary(reinterpret_cast<const char*>(data), size * sizeof(T));
+	}
+	else
+	{
+		using bits_type = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+		for (size_t i = 0; i < size; ++i)
+		{
+			bits_type bits;
+			std::memcpy(&bits, data + i, sizeof(T));
+			bits = Memory::NativeToLittleEndian(bits);
+			msgPackWriter.WriteBinary(reinterpret_cast<const char*>(&bits), sizeof(T));
+		}
+	}
+}
+
+/**
+ * @brief Reads items of typed array which are stored in little-endian byte order.
+ */
+template <typename T, class TReader>
+void ReadTypedArrayItems(TReader& msgPackReader, T* data, size_t size)
+{
+	msgPackReader.ReadBinary(reinterpret_cast<char*>(data), size * sizeof(T));
+	if constexpr (sizeof(T) != 1 && Memory::Endian::native != Memory::Endian::little)
+	{
+		using bits_type = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+		for (size_t i = 0; i < size; ++i)
+		{
+			bits_type bits;
+			std::memcpy(&bits, data + i, sizeof(T));
+			bits = Memory::LittleEndianToNative(bits);
+			std::memcpy(data + i, &bits, sizeof(T));
+		}
+	}
+}
+
 /**
  * @brief Stores the current key in the archive, supports all variant of keys from specified tuple.
  */
@@ -158,6 +290,29 @@ private:
 
 using MsgPackVariableKey = CVariableKey<MsgPackArchiveTraits::supported_key_types>;
 
+/**
+ * @brief Calculates hash of the key, which is used for finding values in the index of object keys.
+ *
+ * Integer keys are hashed by their binary representation, so signed and unsigned forms of the same
+ * value produce the same hash (as they are considered equal in `CVariableKey`).
+ */
+template <typename TKey>
+size_t HashKey(const TKey& key) noexcept
+{
+	if constexpr (std::is_integral_v<TKey>) {
+		return std::hash<uint64_t>()(static_cast<uint64_t>(key));
+	}
+	else if constexpr (std::is_floating_point_v<TKey>) {
+		return std::hash<TKey>()(key);
+	}
+	else if constexpr (std::is_same_v<TKey, CBinTimestamp>) {
+		return std::hash<int64_t>()(key.Seconds) ^ (std::hash<int64_t>()(key.Nanoseconds) << 1);
+	}
+	else {
+		return std::hash<std::string_view>()(std::string_view(key));
+	}
+}
+
 class BITSERIALIZER_API IMsgPackWriter
 {
 public:
@@ -199,8 +354,26 @@ public:
 	virtual void BeginArray(size_t arraySize) = 0;
 	virtual void BeginMap(size_t mapSize) = 0;
 
+	// Writes the header of typed array (items should be written separately via `WriteBinary()` in little-endian byte order)
+	virtual void BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount) = 0;
+
 	virtual void BeginBinary(size_t binarySize) = 0;
 	virtual void WriteBinary(char byte) = 0;
+	virtual void WriteBinary(const char* data, size_t size) = 0;
+
+	// Write sequences of numbers (items of array, header should be written separately)
+	virtual void WriteValues(const uint8_t* values, size_t count) = 0;
+	virtual void WriteValues(const uint16_t* values, size_t count) = 0;
+	virtual void WriteValues(const uint32_t* values, size_t count) = 0;
+	virtual void WriteValues(const uint64_t* values, size_t count) = 0;
+
+	virtual void WriteValues(const int8_t* values, size_t count) = 0;
+	virtual void WriteValues(const int16_t* values, size_t count) = 0;
+	virtual void WriteValues(const int32_t* values, size_t count) = 0;
+	virtual void WriteValues(const int64_t* values, size_t count) = 0;
+
+	virtual void WriteValues(const float* values, size_t count) = 0;
+	virtual void WriteValues(const double* values, size_t count) = 0;
 };
 
 class BITSERIALIZER_API IMsgPackReader
@@ -249,14 +422,543 @@ public:
 	virtual bool ReadValue(CBinTimestamp& timestamp) = 0;
 
 	virtual bool ReadArraySize(size_t& arraySize) = 0;
+	// Reads the size of regular or typed array (`itemType` is `TypedArrayItemType::None` for regular arrays)
+	virtual bool ReadArraySize(size_t& arraySize, TypedArrayItemType& itemType) = 0;
 	virtual bool ReadMapSize(size_t& mapSize) = 0;
 
 	virtual bool ReadBinarySize(size_t& binarySize) = 0;
 	virtual char ReadBinary() = 0;
+	virtual void ReadBinary(char* data, size_t size) = 0;
+
+	// Read sequences of numbers (items of array, mismatched values are handled according to `MismatchedTypesPolicy`)
+	virtual void ReadValues(uint8_t* values, size_t count) = 0;
+	virtual void ReadValues(uint16_t* values, size_t count) = 0;
+	virtual void ReadValues(uint32_t* values, size_t count) = 0;
+	virtual void ReadValues(uint64_t* values, size_t count) = 0;
+
+	virtual void ReadValues(int8_t* values, size_t count) = 0;
+	virtual void ReadValues(int16_t* values, size_t count) = 0;
+	virtual void ReadValues(int32_t* values, size_t count) = 0;
+	virtual void ReadValues(int64_t* values, size_t count) = 0;
+
+	virtual void ReadValues(float* values, size_t count) = 0;
+	virtual void ReadValues(double* values, size_t count) = 0;
 
 	virtual void SkipValue() = 0;
 };
 
+//-----------------------------------------------------------------------------
+// Implementations of MsgPack writers/readers (root scopes are bound to concrete
+// classes, that allows to avoid virtual calls on the hot path)
+//-----------------------------------------------------------------------------
+/**
+ * @brief MsgPack writer to `std::string` or to the fixed buffer provided by caller.
+ *
+ * Implemented in the library for `std::string`, `FixedOutputBuffer` and `COutputStringRef` (see aliases below).
+ *
+ * @tparam TOutput The output type with interface of `std::string`.
+ */
+template <typename TOutput>
+class CMsgPackBasicStringWriter final : public IMsgPackWriter
+{
+public:
+	/// The header of map can be patched after writing its items (see `BeginMapWithUnknownSize()`).
+	static constexpr bool require_map_size = false;
+
+	/// The reference to output (`COutputStringRef` is already a reference, so it is stored by value).
+	using output_ref_type = std::conditional_t<std::is_same_v<TOutput, COutputStringRef>, TOutput, TOutput&>;
+
+	CMsgPackBasicStringWriter(output_ref_type outputString, const SerializationOptions& serializationOptions);
+
+	using IMsgPackWriter::WriteValue;
+
+	void WriteValue(std::nullptr_t) override;
+
+	void WriteValue(bool value) override;
+
+	void WriteValue(uint8_t value) override;
+	void WriteValue(uint16_t value) override;
+	void WriteValue(uint32_t value) override;
+	void WriteValue(uint64_t value) override;
+
+	void WriteValue(int8_t value) override;
+	void WriteValue(int16_t value) override;
+	void WriteValue(int32_t value) override;
+	void WriteValue(int64_t value) override;
+
+	void WriteValue(float value) override;
+	void WriteValue(double value) override;
+
+	void WriteValue(const char* value) override { WriteValue(std::string_view(value)); }
+	void WriteValue(std::string_view value) override;
+
+	void WriteValue(const CBinTimestamp& timestamp) override;
+
+	void BeginArray(size_t arraySize) override;
+	void BeginMap(size_t mapSize) override;
+
+	void BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount) override;
+
+	void BeginBinary(size_t binarySize) override;
+	void WriteBinary(char byte) override { mOutputString.push_back(byte); }
+	void WriteBinary(const char* data, size_t size) override { mOutputString.append(data, size); }
+
+	void WriteValues(const uint8_t* values, size_t count) override;
+	void WriteValues(const uint16_t* values, size_t count) override;
+	void WriteValues(const uint32_t* values, size_t count) override;
+	void WriteValues(const uint64_t* values, size_t count) override;
+
+	void WriteValues(const int8_t* values, size_t count) override;
+	void WriteValues(const int16_t* values, size_t count) override;
+	void WriteValues(const int32_t* values, size_t count) override;
+	void WriteValues(const int64_t* values, size_t count) override;
+
+	void WriteValues(const float* values, size_t count) override;
+	void WriteValues(const double* values, size_t count) override;
+
+	/**
+	 * @brief Writes only the header of string (the content should be written separately).
+	 *
+	 * @param stringSize The size of string in bytes.
+	 */
+	void BeginString(size_t stringSize);
+
+	/**
+	 * @brief Begins the map with unknown size (writes the header, which is patched at the end).
+	 *
+	 * The header of "fixmap" (1 byte) is written by default, the header of "map16" (3 bytes) is reserved when the
+	 * previous map on the same level of nesting had 16 or more items (e.g. in arrays of wide objects).
+	 *
+	 * @return The position of the header, which should be passed to `EndMapWithUnknownSize()`.
+	 */
+	size_t BeginMapWithUnknownSize();
+
+	/**
+	 * @brief Writes the actual size into the header of map, the header is resized only when its size was mispredicted.
+	 *
+	 * @param headerPos The position of the header (returned by `BeginMapWithUnknownSize()`).
+	 * @param mapSize   The number of written key/value pairs.
+	 */
+	void EndMapWithUnknownSize(size_t headerPos, size_t mapSize);
+
+	/**
+	 * @brief Sets the sizes of maps which were counted while measuring the output (see option `reserveExactSize`).
+	 */
+	void SetMeasuredMapSizes(std::vector<size_t>* measuredMapSizes) noexcept { mMeasuredMapSizes = measuredMapSizes; }
+
+	/**
+	 * @brief Takes the measured size of the next map with unknown size (returns `unknown_size` when the output was not measured).
+	 */
+	size_t TakeMeasuredMapSize() noexcept;
+
+	/**
+	 * @brief Does nothing, all data is written directly to the output string.
+	 */
+	static constexpr void Flush() noexcept { }
+
+private:
+	output_ref_type mOutputString;
+	std::vector<size_t>* mMeasuredMapSizes = nullptr;
+	size_t mMeasuredMapIndex = 0;
+	size_t mMapsDepth = 0;
+	uint64_t mLargeMapsMask = 0;
+};
+
+extern template class BITSERIALIZER_API CMsgPackBasicStringWriter<std::string>;
+extern template class BITSERIALIZER_API CMsgPackBasicStringWriter<FixedOutputBuffer>;
+extern template class BITSERIALIZER_API CMsgPackBasicStringWriter<COutputStringRef>;
+
+/// MsgPack writer to `std::string`.
+using CMsgPackStringWriter = CMsgPackBasicStringWriter<std::string>;
+
+/// MsgPack writer to the fixed buffer (when the data does not fit, the writing is stopped, but the size continues to be counted).
+using CMsgPackBufferWriter = CMsgPackBasicStringWriter<FixedOutputBuffer>;
+
+/// MsgPack writer to strings with custom allocators (e.g. `std::pmr::string`).
+using CMsgPackStringRefWriter = CMsgPackBasicStringWriter<COutputStringRef>;
+
+/**
+ * @brief MsgPack writer which does not write anything, only calculates the exact size of encoded data.
+ *
+ * Produces the same size as `CMsgPackStringWriter`, used for measuring objects before saving (see `MeasureObject()`).
+ */
+class BITSERIALIZER_API CMsgPackSizeWriter final : public IMsgPackWriter
+{
+public:
+	/// Maps are measured in the same way as by `CMsgPackStringWriter` (with patching the header of map with unknown size).
+	static constexpr bool require_map_size = false;
+
+	CMsgPackSizeWriter(size_t& outputSize, const SerializationOptions& serializationOptions);
+
+	using IMsgPackWriter::WriteValue;
+
+	void WriteValue(std::nullptr_t) override { ++mOutputSize; }
+
+	void WriteValue(bool) override { ++mOutputSize; }
+
+	void WriteValue(uint8_t value) override;
+	void WriteValue(uint16_t value) override;
+	void WriteValue(uint32_t value) override;
+	void WriteValue(uint64_t value) override;
+
+	void WriteValue(int8_t value) override;
+	void WriteValue(int16_t value) override;
+	void WriteValue(int32_t value) override;
+	void WriteValue(int64_t value) override;
+
+	void WriteValue(float) override { mOutputSize += 1 + sizeof(float); }
+	void WriteValue(double) override { mOutputSize += 1 + sizeof(double); }
+
+	void WriteValue(const char* value) override { WriteValue(std::string_view(value)); }
+	void WriteValue(std::string_view value) override;
+
+	void WriteValue(const CBinTimestamp& timestamp) override;
+
+	void BeginArray(size_t arraySize) override;
+	void BeginMap(size_t mapSize) override;
+
+	void BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount) override;
+
+	void BeginBinary(size_t binarySize) override;
+	void WriteBinary(char) override { ++mOutputSize; }
+	void WriteBinary(const char*, size_t size) override { mOutputSize += size; }
+
+	void WriteValues(const uint8_t* values, size_t count) override;
+	void WriteValues(const uint16_t* values, size_t count) override;
+	void WriteValues(const uint32_t* values, size_t count) override;
+	void WriteValues(const uint64_t* values, size_t count) override;
+
+	void WriteValues(const int8_t* values, size_t count) override;
+	void WriteValues(const int16_t* values, size_t count) override;
+	void WriteValues(const int32_t* values, size_t count) override;
+	void WriteValues(const int64_t* values, size_t count) override;
+
+	void WriteValues(const float*, size_t count) override { mOutputSize += count * (1 + sizeof(float)); }
+	void WriteValues(const double*, size_t count) override { mOutputSize += count * (1 + sizeof(double)); }
+
+	/**
+	 * @brief Counts the smallest header of map (see `CMsgPackStringWriter::BeginMapWithUnknownSize()`).
+	 *
+	 * @return The position of the header, which should be passed to `EndMapWithUnknownSize()`.
+	 */
+	size_t BeginMapWithUnknownSize();
+
+	/**
+	 * @brief Counts the expansion of header when the map has 16 or more items.
+	 *
+	 * @param headerPos The position of the header (returned by `BeginMapWithUnknownSize()`).
+	 * @param mapSize   The number of written key/value pairs.
+	 */
+	void EndMapWithUnknownSize(size_t headerPos, size_t mapSize);
+
+	/**
+	 * @brief Sets the list for storing sizes of maps with unknown size (in the order of their beginning).
+	 *
+	 * The list is passed to the writer which saves the measured object, so it can write exact headers of maps at once.
+	 */
+	void SetMeasuredMapSizes(std::vector<size_t>* measuredMapSizes) noexcept { mMeasuredMapSizes = measuredMapSizes; }
+
+	/**
+	 * @brief Always returns `unknown_size`, as sizes of maps are only counted while measuring.
+	 */
+	static constexpr size_t TakeMeasuredMapSize() noexcept { return unknown_size; }
+
+	/**
+	 * @brief Does nothing, there is no output data.
+	 */
+	static constexpr void Flush() noexcept { }
+
+private:
+	size_t& mOutputSize;
+	std::vector<size_t>* mMeasuredMapSizes = nullptr;
+};
+
+/**
+ * @brief MsgPack writer to `std::ostream`.
+ *
+ * Values are encoded into the staging buffer, which is written to the stream in large blocks
+ * (the size of buffer is configured via `SerializationOptions::streamOptions.writeBufferSize`).
+ */
+class BITSERIALIZER_API CMsgPackStreamWriter final : public IMsgPackWriter
+{
+public:
+	/// Objects are saved in two passes (fields are counted before writing the header of map). The header can't be
+	/// patched in the staging buffer, as it may be flushed before the end of map (the buffer is limited in size), and
+	/// patching via `seekp()` is not possible for all streams (e.g. pipes or files opened with `std::ios::app`).
+	static constexpr bool require_map_size = true;
+
+	CMsgPackStreamWriter(std::ostream& outputStream, const SerializationOptions& serializationOptions);
+	~CMsgPackStreamWriter() override;
+
+	CMsgPackStreamWriter(CMsgPackStreamWriter&&) = delete;
+	CMsgPackStreamWriter& operator=(CMsgPackStreamWriter&&) = delete;
+	CMsgPackStreamWriter(const CMsgPackStreamWriter&) = delete;
+	CMsgPackStreamWriter& operator=(const CMsgPackStreamWriter&) = delete;
+
+	using IMsgPackWriter::WriteValue;
+
+	void WriteValue(std::nullptr_t) override;
+
+	void WriteValue(bool value) override;
+
+	void WriteValue(uint8_t value) override;
+	void WriteValue(uint16_t value) override;
+	void WriteValue(uint32_t value) override;
+	void WriteValue(uint64_t value) override;
+
+	void WriteValue(int8_t value) override;
+	void WriteValue(int16_t value) override;
+	void WriteValue(int32_t value) override;
+	void WriteValue(int64_t value) override;
+
+	void WriteValue(float value) override;
+	void WriteValue(double value) override;
+
+	void WriteValue(const char* value) override { WriteValue(std::string_view(value)); }
+	void WriteValue(std::string_view value) override;
+
+	void WriteValue(const CBinTimestamp& timestamp) override;
+
+	void BeginArray(size_t arraySize) override;
+	void BeginMap(size_t mapSize) override;
+
+	void BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount) override;
+
+	void BeginBinary(size_t binarySize) override;
+	void WriteBinary(char byte) override;
+	void WriteBinary(const char* data, size_t size) override;
+
+	void WriteValues(const uint8_t* values, size_t count) override;
+	void WriteValues(const uint16_t* values, size_t count) override;
+	void WriteValues(const uint32_t* values, size_t count) override;
+	void WriteValues(const uint64_t* values, size_t count) override;
+
+	void WriteValues(const int8_t* values, size_t count) override;
+	void WriteValues(const int16_t* values, size_t count) override;
+	void WriteValues(const int32_t* values, size_t count) override;
+	void WriteValues(const int64_t* values, size_t count) override;
+
+	void WriteValues(const float* values, size_t count) override;
+	void WriteValues(const double* values, size_t count) override;
+
+	/**
+	 * @brief Writes the content of the staging buffer to the output stream.
+	 */
+	void Flush();
+
+private:
+	template <typename T>
+	void WriteValuesImpl(const T* values, size_t count);
+
+	void FlushIfFull()
+	{
+		if (mBuffer.size() >= mBufferSize) {
+			Flush();
+		}
+	}
+
+	std::ostream& mOutputStream;
+	const size_t mBufferSize;
+	std::string mBuffer;
+	CMsgPackStringWriter mBufferWriter;
+};
+
+/**
+ * @brief MsgPack reader from `std::string_view`.
+ */
+class BITSERIALIZER_API CMsgPackStringReader final : public IMsgPackReader
+{
+public:
+	CMsgPackStringReader(std::string_view inputData, const SerializationOptions& serializationOptions) noexcept;
+
+	using IMsgPackReader::ReadValue;
+
+	[[nodiscard]] size_t GetPosition() const noexcept override { return mPos; }
+	void SetPosition(size_t pos) override;
+	[[nodiscard]] ValueType ReadValueType() override;
+	[[nodiscard]] bool IsEnd() const noexcept override { return mPos == mInputData.size(); }
+
+	bool ReadValue(std::nullptr_t&) override;
+	bool ReadValue(bool& value) override;
+
+	bool ReadValue(uint8_t& value) override;
+	bool ReadValue(uint16_t& value) override;
+	bool ReadValue(uint32_t& value) override;
+	bool ReadValue(uint64_t& value) override;
+
+	bool ReadValue(char& value) override;
+	bool ReadValue(int8_t& value) override;
+	bool ReadValue(int16_t& value) override;
+	bool ReadValue(int32_t& value) override;
+	bool ReadValue(int64_t& value) override;
+
+	bool ReadValue(float& value) override;
+	bool ReadValue(double& value) override;
+
+	bool ReadValue(std::string_view& value) override;
+
+	bool ReadValue(CBinTimestamp& timestamp) override;
+
+	bool ReadArraySize(size_t& arraySize) override;
+	bool ReadArraySize(size_t& arraySize, TypedArrayItemType& itemType) override;
+	bool ReadMapSize(size_t& mapSize) override;
+
+	bool ReadBinarySize(size_t& binarySize) override;
+	char ReadBinary() override;
+	void ReadBinary(char* data, size_t size) override;
+
+	void ReadValues(uint8_t* values, size_t count) override;
+	void ReadValues(uint16_t* values, size_t count) override;
+	void ReadValues(uint32_t* values, size_t count) override;
+	void ReadValues(uint64_t* values, size_t count) override;
+
+	void ReadValues(int8_t* values, size_t count) override;
+	void ReadValues(int16_t* values, size_t count) override;
+	void ReadValues(int32_t* values, size_t count) override;
+	void ReadValues(int64_t* values, size_t count) override;
+
+	void ReadValues(float* values, size_t count) override;
+	void ReadValues(double* values, size_t count) override;
+
+	void SkipValue() override;
+
+private:
+	size_t mPos = 0;
+	std::string_view mInputData;
+	const SerializationOptions& mSerializationOptions;
+};
+
+/**
+ * @brief MsgPack reader from sequential input (`std::istream` or `SegmentedInput`).
+ *
+ * @tparam TInput The input type (`std::istream` or `SegmentedInput`).
+ */
+template <typename TInput>
+class CMsgPackBasicStreamReader final : public IMsgPackReader
+{
+public:
+	/// The reader of binary data (buffered stream reader or reader which returns blocks directly from segments).
+	using binary_reader_type = std::conditional_t<std::is_same_v<TInput, SegmentedInput>,
+		BitSerializer::Detail::CBinarySegmentsReader, BitSerializer::Detail::CBinaryStreamReader>;
+	/// The reference to input (the stream is read via non-const reference).
+	using input_ref_type = std::conditional_t<std::is_same_v<TInput, SegmentedInput>, const TInput&, TInput&>;
+
+	CMsgPackBasicStreamReader(input_ref_type input, const SerializationOptions& serializationOptions);
+	~CMsgPackBasicStreamReader() override;
+
+	CMsgPackBasicStreamReader(CMsgPackBasicStreamReader&&) = delete;
+	CMsgPackBasicStreamReader& operator=(CMsgPackBasicStreamReader&&) = delete;
+	CMsgPackBasicStreamReader(const CMsgPackBasicStreamReader&) = delete;
+	CMsgPackBasicStreamReader& operator=(const CMsgPackBasicStreamReader&) = delete;
+
+	using IMsgPackReader::ReadValue;
+
+	[[nodiscard]] size_t GetPosition() const noexcept override;
+	void SetPosition(size_t pos) override;
+	[[nodiscard]] bool IsEnd() const noexcept override;
+
+	[[nodiscard]] ValueType ReadValueType() override;
+
+	bool ReadValue(std::nullptr_t&) override;
+	bool ReadValue(bool& value) override;
+
+	bool ReadValue(uint8_t& value) override;
+	bool ReadValue(uint16_t& value) override;
+	bool ReadValue(uint32_t& value) override;
+	bool ReadValue(uint64_t& value) override;
+
+	bool ReadValue(char& value) override;
+	bool ReadValue(int8_t& value) override;
+	bool ReadValue(int16_t& value) override;
+	bool ReadValue(int32_t& value) override;
+	bool ReadValue(int64_t& value) override;
+
+	bool ReadValue(float& value) override;
+	bool ReadValue(double& value) override;
+
+	bool ReadValue(std::string_view& value) override;
+
+	bool ReadValue(CBinTimestamp& timestamp) override;
+
+	bool ReadArraySize(size_t& arraySize) override;
+	bool ReadArraySize(size_t& arraySize, TypedArrayItemType& itemType) override;
+	bool ReadMapSize(size_t& mapSize) override;
+
+	bool ReadBinarySize(size_t& binarySize) override;
+	char ReadBinary() override;
+	void ReadBinary(char* data, size_t size) override;
+
+	void ReadValues(uint8_t* values, size_t count) override;
+	void ReadValues(uint16_t* values, size_t count) override;
+	void ReadValues(uint32_t* values, size_t count) override;
+	void ReadValues(uint64_t* values, size_t count) override;
+
+	void ReadValues(int8_t* values, size_t count) override;
+	void ReadValues(int16_t* values, size_t count) override;
+	void ReadValues(int32_t* values, size_t count) override;
+	void ReadValues(int64_t* values, size_t count) override;
+
+	void ReadValues(float* values, size_t count) override;
+	void ReadValues(double* values, size_t count) override;
+
+	void SkipValue() override;
+
+	/**
+	 * @brief Checks whether there are more data in the stream (unlike `IsEnd()`, it reads the next chunk when the buffer is empty).
+	 */
+	[[nodiscard]] bool HasMoreData();
+
+private:
+	std::unique_ptr<binary_reader_type> mBinaryStreamReader;
+	const SerializationOptions& mSerializationOptions;
+	std::string mBuffer;
+};
+
+extern template class BITSERIALIZER_API CMsgPackBasicStreamReader<std::istream>;
+extern template class BITSERIALIZER_API CMsgPackBasicStreamReader<SegmentedInput>;
+
+/// MsgPack reader from `std::istream`.
+using CMsgPackStreamReader = CMsgPackBasicStreamReader<std::istream>;
+
+/// MsgPack reader from the sequence of segments (values that straddle the boundary of segments are copied to temporary buffer).
+using CMsgPackSegmentedReader = CMsgPackBasicStreamReader<SegmentedInput>;
+
+/**
+ * @brief Finds the end of MsgPack value in the data which is received in parts (e.g. from non-blocking socket).
+ *
+ * The state of scanning is kept between calls, so already received data is not scanned twice.
+ */
+class BITSERIALIZER_API CMsgPackValueScanner
+{
+public:
+	/**
+	 * @param maxValueSize The maximum size of value, which is checked against the lengths declared in its headers.
+	 */
+	explicit CMsgPackValueScanner(size_t maxValueSize = (std::numeric_limits<size_t>::max)()) noexcept
+		: mMaxValueSize(maxValueSize)
+	{ }
+
+	/**
+	 * @brief Continues scanning of the value.
+	 *
+	 * @param data The data from the beginning of value (including data which was passed in previous calls).
+	 * @return The size of value or 0 when more data is needed.
+	 * @throws ParsingException When the declared size of value (or number of its items) exceeds the maximum size.
+	 */
+	[[nodiscard]] size_t Scan(std::string_view data);
+
+	/**
+	 * @brief Resets the state for scanning the next value.
+	 */
+	void Reset() noexcept;
+
+private:
+	size_t mMaxValueSize;
+	size_t mPos = 0;
+	// The number of values which remain to scan (keys and values of maps are counted separately)
+	uint64_t mPendingValues = 1;
+};
+
 //-----------------------------------------------------------------------------
 // MsgPack writers
 //-----------------------------------------------------------------------------
@@ -291,6 +993,26 @@ public:
 		return true;
 	}
 
+	/**
+	 * @brief Writes a block of bytes at once (fast path for contiguous binary containers).
+	 *
+	 * @param data Pointer to the bytes to write.
+	 * @param size Number of bytes.
+	 * @return The number of written bytes.
+	 */
+	template <typename T, std::enable_if_t<is_binary_byte_v<T>, int> = 0>
+	size_t SerializeBlock(T* data, size_t size)
+	{
+		if (size > mSize - mIndex)
+		{
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Attempt to write more bytes than was declared for that binary array");
+		}
+
+		mMsgPackWriter->WriteBinary(reinterpret_cast<const char*>(data), size);
+		mIndex += size;
+		return size;
+	}
+
 private:
 	TWriter* mMsgPackWriter;
 	size_t mSize;
@@ -305,26 +1027,68 @@ template <class TWriter>
 class CMsgPackWriteArrayScope final : public MsgPackArchiveTraits, public TArchiveScope<SerializeMode::Save>
 {
 public:
-	CMsgPackWriteArrayScope(size_t arraySize, TWriter* msgPackWriter, SerializationContext& serializationContext) noexcept
+	static constexpr bool require_map_size = TWriter::require_map_size;
+
+	/**
+	 * @brief Writes the header of array, it is deferred when the array can be saved as typed array (see `SerializationOptions::useTypedArrays`).
+	 */
+	CMsgPackWriteArrayScope(size_t arraySize, TWriter* msgPackWriter, SerializationContext& serializationContext)
 		: TArchiveScope<SerializeMode::Save>(serializationContext)
 		, mMsgPackWriter(msgPackWriter)
 		, mSize(arraySize)
-	{ }
+		, mIsHeaderDeferred(arraySize != 0 && serializationContext.GetOptions().useTypedArrays)
+	{
+		if (!mIsHeaderDeferred) {
+			mMsgPackWriter->BeginArray(arraySize);
+		}
+	}
 
 	template <typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_null_pointer_v<T>
 		|| std::is_same_v<T, std::string_view> || std::is_same_v<T, CBinTimestamp>, int> = 0>
 	bool SerializeValue(T& value)
 	{
 		CheckEnd();
+		WriteDeferredHeader();
 		mMsgPackWriter->WriteValue(value);
 		++mIndex;
 		return true;
 	}
 
+	/**
+	 * @brief Writes a sequence of numbers at once (fast path for contiguous containers).
+	 *
+	 * @param data Pointer to the first number.
+	 * @param size Number of items.
+	 * @return The number of written items.
+	 */
+	template <typename T, std::enable_if_t<is_block_number_v<T>, int> = 0>
+	size_t SerializeBlock(T* data, size_t size)
+	{
+		if (size > mSize - mIndex)
+		{
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Attempt to write more elements than was stated for that array");
+		}
+
+		if (mIsHeaderDeferred && size == mSize)
+		{
+			// The whole array is written at once, so it can be saved as typed array
+			mIsHeaderDeferred = false;
+			mMsgPackWriter->BeginTypedArray(typed_array_item_type_v<T>, size);
+			WriteTypedArrayItems(*mMsgPackWriter, data, size);
+		}
+		else
+		{
+			WriteDeferredHeader();
+			mMsgPackWriter->WriteValues(data, size);
+		}
+		mIndex += size;
+		return size;
+	}
+
 	[[nodiscard]] std::optional<CMsgPackWriteArrayScope<TWriter>> OpenArrayScope(size_t arraySize)
 	{
 		CheckEnd();
-		mMsgPackWriter->BeginArray(arraySize);
+		WriteDeferredHeader();
 		++mIndex;
 		return std::make_optional<CMsgPackWriteArrayScope<TWriter>>(arraySize, mMsgPackWriter, GetContext());
 	}
@@ -332,7 +1096,7 @@ public:
 	[[nodiscard]] std::optional<CMsgPackWriteObjectScope<TWriter>> OpenObjectScope(size_t mapSize)
 	{
 		CheckEnd();
-		mMsgPackWriter->BeginMap(mapSize);
+		WriteDeferredHeader();
 		++mIndex;
 		return std::make_optional<CMsgPackWriteObjectScope<TWriter>>(mapSize, mMsgPackWriter, GetContext());
 	}
@@ -340,6 +1104,7 @@ public:
 	[[nodiscard]] std::optional<CMsgPackWriteBinaryScope<TWriter>> OpenBinaryScope(size_t binarySize)
 	{
 		CheckEnd();
+		WriteDeferredHeader();
 		mMsgPackWriter->BeginBinary(binarySize);
 		++mIndex;
 		return std::make_optional<CMsgPackWriteBinaryScope<TWriter>>(binarySize, mMsgPackWriter, GetContext());
@@ -354,9 +1119,19 @@ private:
 		}
 	}
 
+	void WriteDeferredHeader()
+	{
+		if (mIsHeaderDeferred)
+		{
+			mIsHeaderDeferred = false;
+			mMsgPackWriter->BeginArray(mSize);
+		}
+	}
+
 	TWriter* mMsgPackWriter;
 	size_t mSize;
 	size_t mIndex = 0;
+	bool mIsHeaderDeferred;
 };
 
 
@@ -367,18 +1142,82 @@ template <class TWriter>
 class CMsgPackWriteObjectScope final : public MsgPackArchiveTraits, public TArchiveScope<SerializeMode::Save>
 {
 public:
-	CMsgPackWriteObjectScope(size_t mapSize, TWriter* msgPackWriter, SerializationContext& serializationContext) noexcept
+	static constexpr bool require_map_size = TWriter::require_map_size;
+
+	/**
+	 * @brief Writes the header of map, the size can be `unknown_size` when the writer does not require it.
+	 */
+	CMsgPackWriteObjectScope(size_t mapSize, TWriter* msgPackWriter, SerializationContext& serializationContext)
 		: TArchiveScope<SerializeMode::Save>(serializationContext)
 		, mMsgPackWriter(msgPackWriter)
 		, mSize(mapSize)
-	{ }
+	{
+		if constexpr (!require_map_size)
+		{
+			if (mapSize == unknown_size)
+			{
+				// The exact size is known when the output was measured before saving (see option `reserveExactSize`)
+				mSize = mMsgPackWriter->TakeMeasuredMapSize();
+				if (mSize == unknown_size)
+				{
+					mHeaderPos = mMsgPackWriter->BeginMapWithUnknownSize();
+					return;
+				}
+			}
+		}
+		mMsgPackWriter->BeginMap(mSize);
+	}
+
+	~CMsgPackWriteObjectScope()
+	{
+		if (!mClosed && !GetContext().IsStackUnwinding())
+		{
+			if constexpr (!require_map_size)
+			{
+				if (mSize == unknown_size)
+				{
+					mMsgPackWriter->EndMapWithUnknownSize(mHeaderPos, mIndex);
+					return;
+				}
+			}
+			// Exception can't be thrown from the destructor, objects are closed explicitly via `Close()`
+			assert(mIndex == mSize);
+		}
+	}
+
+	/**
+	 * @brief Completes the map: writes its size when it was unknown or checks the number of written items.
+	 *
+	 * @throws SerializationException with code `OutOfRange` when the number of written items is less than
+	 *         stated for that map (e.g. via `BITSERIALIZER_FIXED_FIELDS()`).
+	 */
+	void Close()
+	{
+		if (mClosed) {
+			return;
+		}
+		mClosed = true;
+
+		if constexpr (!require_map_size)
+		{
+			if (mSize == unknown_size)
+			{
+				mMsgPackWriter->EndMapWithUnknownSize(mHeaderPos, mIndex);
+				return;
+			}
+		}
+		if (mIndex != mSize)
+		{
+			throw SerializationException(SerializationErrorCode::OutOfRange, "The number of written items is less than was stated for that map");
+		}
+	}
 
 	template <typename TKey, typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_null_pointer_v<T>
 		|| std::is_same_v<T, string_view_type> || std::is_same_v<T, CBinTimestamp>, int> = 0>
 	bool SerializeValue(TKey&& key, T& value)
 	{
 		CheckEnd();
-		mMsgPackWriter->WriteValue(key);
+		WriteKey(key);
 		mMsgPackWriter->WriteValue(value);
 		++mIndex;
 		return true;
@@ -388,8 +1227,7 @@ public:
 	std::optional<CMsgPackWriteArrayScope<TWriter>> OpenArrayScope(TKey&& key, size_t arraySize)
 	{
 		CheckEnd();
-		mMsgPackWriter->WriteValue(key);
-		mMsgPackWriter->BeginArray(arraySize);
+		WriteKey(key);
 		++mIndex;
 		return std::make_optional<CMsgPackWriteArrayScope<TWriter>>(arraySize, mMsgPackWriter, GetContext());
 	}
@@ -398,8 +1236,7 @@ public:
 	[[nodiscard]] std::optional<CMsgPackWriteObjectScope<TWriter>> OpenObjectScope(TKey&& key, size_t mapSize)
 	{
 		CheckEnd();
-		mMsgPackWriter->WriteValue(key);
-		mMsgPackWriter->BeginMap(mapSize);
+		WriteKey(key);
 		++mIndex;
 		return std::make_optional<CMsgPackWriteObjectScope<TWriter>>(mapSize, mMsgPackWriter, GetContext());
 	}
@@ -408,13 +1245,33 @@ public:
 	[[nodiscard]] std::optional<CMsgPackWriteBinaryScope<TWriter>> OpenBinaryScope(TKey&& key, size_t binarySize)
 	{
 		CheckEnd();
-		mMsgPackWriter->WriteValue(key);
+		WriteKey(key);
 		mMsgPackWriter->BeginBinary(binarySize);
 		++mIndex;
 		return std::make_optional<CMsgPackWriteBinaryScope<TWriter>>(binarySize, mMsgPackWriter, GetContext());
 	}
 
 private:
+	/**
+	 * @brief Writes the key, short string literals are encoded on the stack and appended to the output as one block.
+	 */
+	template <typename TKey>
+	void WriteKey(const TKey& key)
+	{
+		if constexpr (std::is_array_v<TKey> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<TKey>>, char> && std::extent_v<TKey> <= 32)
+		{
+			// The length of string literal is calculated at compile time (after inlining)
+			const size_t keySize = std::char_traits<char>::length(key);
+			char encodedKey[std::extent_v<TKey>];
+			encodedKey[0] = static_cast<char>(0xA0u | keySize);
+			std::memcpy(encodedKey + 1, key, std::extent_v<TKey> - 1);
+			mMsgPackWriter->WriteBinary(encodedKey, keySize + 1);
+		}
+		else {
+			mMsgPackWriter->WriteValue(key);
+		}
+	}
+
 	void CheckEnd() const
 	{
 		if (mIndex == mSize)
@@ -426,23 +1283,41 @@ private:
 	TWriter* mMsgPackWriter;
 	size_t mSize;
 	size_t mIndex = 0;
+	size_t mHeaderPos = 0;
+	bool mClosed = false;
 };
 
 
 /**
  * @brief MsgPack root scope for writing data (can write array or object).
+ *
+ * @tparam TWriter The concrete writer (`CMsgPackStringWriter`, `CMsgPackBufferWriter` or `CMsgPackStreamWriter`).
  */
-class BITSERIALIZER_API MsgPackWriteRootScope final : public MsgPackArchiveTraits, public TArchiveScope<SerializeMode::Save>
+template <class TWriter>
+class CMsgPackWriteRootScope final : public MsgPackArchiveTraits, public TArchiveScope<SerializeMode::Save>
 {
 public:
-	MsgPackWriteRootScope(std::string& outputData, SerializationContext& serializationContext);
-	MsgPackWriteRootScope(std::ostream& outputStream, SerializationContext& serializationContext);
-	~MsgPackWriteRootScope();
+	static constexpr bool require_map_size = TWriter::require_map_size;
 
-	MsgPackWriteRootScope(MsgPackWriteRootScope&&) = delete;
-	MsgPackWriteRootScope& operator=(MsgPackWriteRootScope&&) = delete;
-	MsgPackWriteRootScope(const MsgPackWriteRootScope&) = delete;
-	MsgPackWriteRootScope& operator=(const MsgPackWriteRootScope&) = delete;
+	template <typename TOutput, std::enable_if_t<std::is_constructible_v<TWriter, TOutput&, const SerializationOptions&>, int> = 0>
+	CMsgPackWriteRootScope(TOutput& output, SerializationContext& serializationContext)
+		: TArchiveScope<SerializeMode::Save>(serializationContext)
+		, mMsgPackWriter(output, serializationContext.GetOptions())
+	{
+		if constexpr (!require_map_size)
+		{
+			// The measuring and saving passes share the context, so sizes of maps counted by the first one are used by the second
+			if (serializationContext.GetOptions().reserveExactSize) {
+				mMsgPackWriter.SetMeasuredMapSizes(&serializationContext.GetMeasuredObjectSizes());
+			}
+		}
+	}
+
+	CMsgPackWriteRootScope(CMsgPackWriteRootScope&&) = delete;
+	CMsgPackWriteRootScope& operator=(CMsgPackWriteRootScope&&) = delete;
+	CMsgPackWriteRootScope(const CMsgPackWriteRootScope&) = delete;
+	CMsgPackWriteRootScope& operator=(const CMsgPackWriteRootScope&) = delete;
+	~CMsgPackWriteRootScope() = default;
 
 	/**
 	 * @brief Gets the current path in MsgPack.
@@ -456,32 +1331,33 @@ public:
 		|| std::is_same_v<T, string_view_type> || std::is_same_v<T, CBinTimestamp>, int> = 0>
 	bool SerializeValue(T& value)
 	{
-		mMsgPackWriter->WriteValue(value);
+		mMsgPackWriter.WriteValue(value);
 		return true;
 	}
 
-	[[nodiscard]] std::optional<CMsgPackWriteArrayScope<IMsgPackWriter>> OpenArrayScope(size_t arraySize) const
+	[[nodiscard]] std::optional<CMsgPackWriteArrayScope<TWriter>> OpenArrayScope(size_t arraySize)
 	{
-		mMsgPackWriter->BeginArray(arraySize);
-		return std::make_optional<CMsgPackWriteArrayScope<IMsgPackWriter>>(arraySize, mMsgPackWriter, GetContext());
+		return std::make_optional<CMsgPackWriteArrayScope<TWriter>>(arraySize, &mMsgPackWriter, GetContext());
 	}
 
-	[[nodiscard]] std::optional<CMsgPackWriteObjectScope<IMsgPackWriter>> OpenObjectScope(size_t mapSize) const
+	[[nodiscard]] std::optional<CMsgPackWriteObjectScope<TWriter>> OpenObjectScope(size_t mapSize)
 	{
-		mMsgPackWriter->BeginMap(mapSize);
-		return std::make_optional<CMsgPackWriteObjectScope<IMsgPackWriter>>(mapSize, mMsgPackWriter, GetContext());
+		return std::make_optional<CMsgPackWriteObjectScope<TWriter>>(mapSize, &mMsgPackWriter, GetContext());
 	}
 
-	[[nodiscard]] std::optional<CMsgPackWriteBinaryScope<IMsgPackWriter>> OpenBinaryScope(size_t binarySize) const
+	[[nodiscard]] std::optional<CMsgPackWriteBinaryScope<TWriter>> OpenBinaryScope(size_t binarySize)
 	{
-		mMsgPackWriter->BeginBinary(binarySize);
-		return std::make_optional<CMsgPackWriteBinaryScope<IMsgPackWriter>>(binarySize, mMsgPackWriter, GetContext());
+		mMsgPackWriter.BeginBinary(binarySize);
+		return std::make_optional<CMsgPackWriteBinaryScope<TWriter>>(binarySize, &mMsgPackWriter, GetContext());
 	}
 
-	static constexpr void Finalize() noexcept { /* Not required */ }
+	void Finalize()
+	{
+		mMsgPackWriter.Flush();
+	}
 
 private:
-	IMsgPackWriter* mMsgPackWriter = nullptr;
+	TWriter mMsgPackWriter;
 };
 
 
@@ -563,6 +1439,22 @@ public:
 		return true;
 	}
 
+	/**
+	 * @brief Reads a block of bytes at once (fast path for contiguous binary containers).
+	 *
+	 * @param data Pointer to the target buffer.
+	 * @param size Size of the target buffer.
+	 * @return The number of loaded bytes (can be less than buffer size when there are no more items).
+	 */
+	template <typename T, std::enable_if_t<is_binary_byte_v<T>, int> = 0>
+	size_t SerializeBlock(T* data, size_t size)
+	{
+		const size_t blockSize = std::min(size, mSize - mIndex);
+		mMsgPackReader->ReadBinary(reinterpret_cast<char*>(data), blockSize);
+		mIndex += blockSize;
+		return blockSize;
+	}
+
 	/**
 	 * @brief Returns the estimated number of items to load (for reserving the size of containers).
 	 */
@@ -600,11 +1492,13 @@ template <class TReader>
 class CMsgPackReadArrayScope final : public CMsgPackScopeBase, public TArchiveScope<SerializeMode::Load>
 {
 public:
-	CMsgPackReadArrayScope(size_t arraySize, TReader* msgPackReader, SerializationContext& serializationContext, CMsgPackScopeBase* parentScope = nullptr) noexcept
+	CMsgPackReadArrayScope(size_t arraySize, TypedArrayItemType itemType, TReader* msgPackReader, SerializationContext& serializationContext,
+		CMsgPackScopeBase* parentScope = nullptr) noexcept
 		: CMsgPackScopeBase(parentScope)
 		, TArchiveScope<SerializeMode::Load>(serializationContext)
 		, mMsgPackReader(msgPackReader)
 		, mSize(arraySize)
+		, mItemType(itemType)
 	{ }
 
 	/**
@@ -623,6 +1517,11 @@ public:
 	bool SerializeValue(T& value)
 	{
 		CheckEnd();
+		if (mItemType != TypedArrayItemType::None)
+		{
+			++mIndex;
+			return ReadTypedArrayItem(value);
+		}
 		if (mMsgPackReader->ReadValue(value))
 		{
 			++mIndex;
@@ -631,6 +1530,33 @@ public:
 		return false;
 	}
 
+	/**
+	 * @brief Reads a sequence of numbers at once (fast path for contiguous containers).
+	 *
+	 * @param data Pointer to the first number.
+	 * @param size Maximum number of items to read.
+	 * @return The number of read items (less than requested when the end of array is reached).
+	 */
+	template <typename T, std::enable_if_t<is_block_number_v<T>, int> = 0>
+	size_t SerializeBlock(T* data, size_t size)
+	{
+		const size_t count = (std::min)(size, mSize - mIndex);
+		if (mItemType == TypedArrayItemType::None) {
+			mMsgPackReader->ReadValues(data, count);
+		}
+		else if (mItemType == typed_array_item_type_v<T>) {
+			ReadTypedArrayItems(*mMsgPackReader, data, count);
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i) {
+				ReadTypedArrayItem(data[i]);
+			}
+		}
+		mIndex += count;
+		return count;
+	}
+
 	/**
 	 * @brief Returns the estimated number of items to load (for reserving the size of containers).
 	 */
@@ -650,10 +1576,16 @@ public:
 	std::optional<CMsgPackReadArrayScope<TReader>> OpenArrayScope(size_t)
 	{
 		CheckEnd();
-		if (size_t sz = 0; mMsgPackReader->ReadArraySize(sz))
+		if (mItemType != TypedArrayItemType::None)
+		{
+			SkipMismatchedTypedArrayItem();
+			return std::nullopt;
+		}
+		size_t sz = 0;
+		if (auto itemType = TypedArrayItemType::None; mMsgPackReader->ReadArraySize(sz, itemType))
 		{
 			++mIndex;
-			return std::make_optional<CMsgPackReadArrayScope<TReader>>(sz, mMsgPackReader, GetContext(), this);
+			return std::make_optional<CMsgPackReadArrayScope<TReader>>(sz, itemType, mMsgPackReader, GetContext(), this);
 		}
 		return std::nullopt;
 	}
@@ -661,6 +1593,11 @@ public:
 	std::optional<CMsgPackReadObjectScope<TReader>> OpenObjectScope(size_t)
 	{
 		CheckEnd();
+		if (mItemType != TypedArrayItemType::None)
+		{
+			SkipMismatchedTypedArrayItem();
+			return std::nullopt;
+		}
 		if (size_t sz = 0; mMsgPackReader->ReadMapSize(sz))
 		{
 			++mIndex;
@@ -669,8 +1606,14 @@ public:
 		return std::nullopt;
 	}
 
-	[[nodiscard]] std::optional<CMsgPackReadBinaryScope<TReader>> OpenBinaryScope(size_t) const
+	[[nodiscard]] std::optional<CMsgPackReadBinaryScope<TReader>> OpenBinaryScope(size_t)
 	{
+		if (mItemType != TypedArrayItemType::None)
+		{
+			CheckEnd();
+			SkipMismatchedTypedArrayItem();
+			return std::nullopt;
+		}
 		if (size_t sz = 0; mMsgPackReader->ReadBinarySize(sz)) {
 			return std::make_optional<CMsgPackReadBinaryScope<TReader>>(sz, mMsgPackReader, GetContext());
 		}
@@ -685,9 +1628,62 @@ private:
 		}
 	}
 
+	/**
+	 * @brief Reads the next item of typed array and converts it to the target type according to policies.
+	 */
+	template <typename T>
+	bool ReadTypedArrayItem(T& value)
+	{
+		switch (mItemType)
+		{
+		case TypedArrayItemType::UInt8: return ReadTypedArrayItemAs<uint8_t>(value);
+		case TypedArrayItemType::UInt16: return ReadTypedArrayItemAs<uint16_t>(value);
+		case TypedArrayItemType::UInt32: return ReadTypedArrayItemAs<uint32_t>(value);
+		case TypedArrayItemType::UInt64: return ReadTypedArrayItemAs<uint64_t>(value);
+		case TypedArrayItemType::Int8: return ReadTypedArrayItemAs<int8_t>(value);
+		case TypedArrayItemType::Int16: return ReadTypedArrayItemAs<int16_t>(value);
+		case TypedArrayItemType::Int32: return ReadTypedArrayItemAs<int32_t>(value);
+		case TypedArrayItemType::Int64: return ReadTypedArrayItemAs<int64_t>(value);
+		case TypedArrayItemType::Float: return ReadTypedArrayItemAs<float>(value);
+		case TypedArrayItemType::Double: return ReadTypedArrayItemAs<double>(value);
+		default:
+			throw std::runtime_error("Internal error: invalid type of items in typed array");
+		}
+	}
+
+	template <typename TItem, typename T>
+	bool ReadTypedArrayItemAs(T& value)
+	{
+		TItem item;
+		ReadTypedArrayItems(*mMsgPackReader, &item, 1);
+		if constexpr (std::is_same_v<TItem, T>)
+		{
+			value = item;
+			return true;
+		}
+		else
+		{
+			const auto& options = GetOptions();
+			return BitSerializer::Detail::ConvertByPolicy(item, value, options.mismatchedTypesPolicy, options.overflowNumberPolicy);
+		}
+	}
+
+	void SkipMismatchedTypedArrayItem()
+	{
+		if (GetOptions().mismatchedTypesPolicy == MismatchedTypesPolicy::ThrowError)
+		{
+			throw SerializationException(SerializationErrorCode::MismatchedTypes,
+				"The target field type does not match the value being loaded");
+		}
+		char item[sizeof(uint64_t)];
+		mMsgPackReader->ReadBinary(item, GetTypedArrayItemSize(mItemType));
+		++mIndex;
+	}
+
 	TReader* mMsgPackReader;
 	size_t mSize;
 	size_t mIndex = 0;
+	TypedArrayItemType mItemType;
 };
 
 
@@ -710,6 +1706,15 @@ public:
 	{
 		if (!GetContext().IsStackUnwinding())
 		{
+			if (!mKeysIndex.empty())
+			{
+				// The end of the object is already known from the index
+				mCurrentKey.Reset();
+				mMsgPackReader->SetPosition(mEndPos);
+				mIndex = mSize;
+				return;
+			}
+
 			ResetKey();
 			// Skip key/value pairs ​​that were not read
 			for (size_t c = mIndex; c < mSize; ++c)
@@ -779,8 +1784,9 @@ public:
 	{
 		if (FindValueByKey(key))
 		{
-			if (size_t sz = 0; mMsgPackReader->ReadArraySize(sz)) {
-				return std::make_optional<CMsgPackReadArrayScope<TReader>>(sz, mMsgPackReader, GetContext(), this);
+			size_t sz = 0;
+			if (auto itemType = TypedArrayItemType::None; mMsgPackReader->ReadArraySize(sz, itemType)) {
+				return std::make_optional<CMsgPackReadArrayScope<TReader>>(sz, itemType, mMsgPackReader, GetContext(), this);
 			}
 			OnFinishChildScope();
 		}
@@ -805,10 +1811,14 @@ public:
 	{
 		if (FindValueByKey(key))
 		{
+			const size_t valuePos = mMsgPackReader->GetPosition();
 			if (size_t sz = 0; mMsgPackReader->ReadBinarySize(sz)) {
 				return std::make_optional<CMsgPackReadBinaryScope<TReader>>(sz, mMsgPackReader, GetContext(), this);
 			}
-			OnFinishChildScope();
+			// Keep the current key when the value was not consumed (an array can be loaded via `OpenArrayScope()`)
+			if (mMsgPackReader->GetPosition() != valuePos) {
+				OnFinishChildScope();
+			}
 		}
 		return std::nullopt;
 	}
@@ -871,6 +1881,19 @@ private:
 			ResetKey();
 		}
 
+		if (mSize >= KeysIndexMinSize)
+		{
+			// Check the next key first (the most common case when fields are loaded in the same order)
+			if (mIndex < mSize)
+			{
+				ReadKey([](auto&&) {});
+				if (mCurrentKey == key) {
+					return true;
+				}
+			}
+			return FindValueByKeysIndex(key);
+		}
+
 		for (size_t c = 0; c < mSize; ++c)
 		{
 			if (mIndex == mSize)
@@ -889,6 +1912,57 @@ private:
 		return false;
 	}
 
+	/**
+	 * @brief Finds the value via index of keys (the index is built at first call).
+	 */
+	template <typename TKey>
+	bool FindValueByKeysIndex(TKey&& key)
+	{
+		if (mKeysIndex.empty()) {
+			BuildKeysIndex();
+		}
+
+		const size_t hash = HashKey(key);
+		auto it = std::lower_bound(mKeysIndex.cbegin(), mKeysIndex.cend(), hash, [](const KeyIndexEntry& entry, size_t value) {
+			return entry.Hash < value;
+		});
+		for (; it != mKeysIndex.cend() && it->Hash == hash; ++it)
+		{
+			mMsgPackReader->SetPosition(it->KeyPos);
+			mIndex = it->Ordinal;
+			ReadKey([](auto&&) {});
+			if (mCurrentKey == key) {
+				return true;
+			}
+		}
+
+		mCurrentKey.Reset();
+		mMsgPackReader->SetPosition(mEndPos);
+		mIndex = mSize;
+		return false;
+	}
+
+	void BuildKeysIndex()
+	{
+		mCurrentKey.Reset();
+		mMsgPackReader->SetPosition(mStartPos);
+		mKeysIndex.reserve(mSize);
+		for (mIndex = 0; mIndex < mSize; ++mIndex)
+		{
+			KeyIndexEntry entry { 0, mMsgPackReader->GetPosition(), mIndex };
+			ReadKey([&entry](auto&& k) {
+				entry.Hash = HashKey(k);
+			});
+			mMsgPackReader->SkipValue();
+			mKeysIndex.push_back(entry);
+		}
+		mCurrentKey.Reset();
+		mEndPos = mMsgPackReader->GetPosition();
+		std::sort(mKeysIndex.begin(), mKeysIndex.end(), [](const KeyIndexEntry& lhs, const KeyIndexEntry& rhs) {
+			return lhs.Hash < rhs.Hash || (lhs.Hash == rhs.Hash && lhs.Ordinal < rhs.Ordinal);
+		});
+	}
+
 	void ResetKey()
 	{
 		if (mCurrentKey)
@@ -899,23 +1973,46 @@ private:
 		}
 	}
 
+	/// Minimum number of key/value pairs for building index of keys (small objects are faster to scan).
+	static constexpr size_t KeysIndexMinSize = 16;
+
+	struct KeyIndexEntry
+	{
+		size_t Hash;
+		size_t KeyPos;
+		size_t Ordinal;
+	};
+
 	TReader* mMsgPackReader;
 	size_t mStartPos;
+	size_t mEndPos = 0;
 	const size_t mSize;
 	size_t mIndex = 0;
 	MsgPackVariableKey mCurrentKey;
+	std::vector<KeyIndexEntry> mKeysIndex;
 };
 
 
 /**
  * @brief MsgPack root scope for reading data (can read array or object).
+ *
+ * @tparam TReader The concrete reader (`CMsgPackStringReader`, `CMsgPackStreamReader` or `CMsgPackSegmentedReader`).
  */
-class BITSERIALIZER_API MsgPackReadRootScope final : public MsgPackArchiveTraits, public TArchiveScope<SerializeMode::Load>
+template <class TReader>
+class CMsgPackReadRootScope final : public MsgPackArchiveTraits, public TArchiveScope<SerializeMode::Load>
 {
 public:
-	MsgPackReadRootScope(std::string_view inputData, SerializationContext& serializationContext);
-	MsgPackReadRootScope(std::istream& inputStream, SerializationContext& serializationContext);
-	~MsgPackReadRootScope();
+	template <typename TInput, std::enable_if_t<std::is_constructible_v<TReader, TInput&, const SerializationOptions&>, int> = 0>
+	CMsgPackReadRootScope(TInput& input, SerializationContext& serializationContext)
+		: TArchiveScope<SerializeMode::Load>(serializationContext)
+		, mMsgPackReader(input, serializationContext.GetOptions())
+	{ }
+
+	CMsgPackReadRootScope(CMsgPackReadRootScope&&) = delete;
+	CMsgPackReadRootScope& operator=(CMsgPackReadRootScope&&) = delete;
+	CMsgPackReadRootScope(const CMsgPackReadRootScope&) = delete;
+	CMsgPackReadRootScope& operator=(const CMsgPackReadRootScope&) = delete;
+	~CMsgPackReadRootScope() = default;
 
 	/**
 	 * @brief Gets the current path in MsgPack.
@@ -927,39 +2024,48 @@ public:
 
 	template <typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_null_pointer_v<T>
 		|| std::is_same_v<T, string_view_type> || std::is_same_v<T, CBinTimestamp>, int> = 0>
-	bool SerializeValue(T& value) const
+	bool SerializeValue(T& value)
 	{
-		return mMsgPackReader->ReadValue(value);
+		return mMsgPackReader.ReadValue(value);
 	}
 
-	[[nodiscard]] std::optional<CMsgPackReadArrayScope<IMsgPackReader>> OpenArrayScope(size_t) const
+	[[nodiscard]] std::optional<CMsgPackReadArrayScope<TReader>> OpenArrayScope(size_t)
 	{
-		if (size_t sz = 0; mMsgPackReader->ReadArraySize(sz)) {
-			return std::make_optional<CMsgPackReadArrayScope<IMsgPackReader>>(sz, mMsgPackReader, GetContext());
+		size_t sz = 0;
+		if (auto itemType = TypedArrayItemType::None; mMsgPackReader.ReadArraySize(sz, itemType)) {
+			return std::make_optional<CMsgPackReadArrayScope<TReader>>(sz, itemType, &mMsgPackReader, GetContext());
 		}
 		return std::nullopt;
 	}
 
-	[[nodiscard]] std::optional<CMsgPackReadObjectScope<IMsgPackReader>> OpenObjectScope(size_t) const
+	[[nodiscard]] std::optional<CMsgPackReadObjectScope<TReader>> OpenObjectScope(size_t)
 	{
-		if (size_t sz = 0; mMsgPackReader->ReadMapSize(sz)) {
-			return std::make_optional<CMsgPackReadObjectScope<IMsgPackReader>>(sz, mMsgPackReader, GetContext());
+		if (size_t sz = 0; mMsgPackReader.ReadMapSize(sz)) {
+			return std::make_optional<CMsgPackReadObjectScope<TReader>>(sz, &mMsgPackReader, GetContext());
 		}
 		return std::nullopt;
 	}
 
-	[[nodiscard]] std::optional<CMsgPackReadBinaryScope<IMsgPackReader>> OpenBinaryScope(size_t) const
+	[[nodiscard]] std::optional<CMsgPackReadBinaryScope<TReader>> OpenBinaryScope(size_t)
 	{
-		if (size_t sz = 0; mMsgPackReader->ReadBinarySize(sz)) {
-			return std::make_optional<CMsgPackReadBinaryScope<IMsgPackReader>>(sz, mMsgPackReader, GetContext());
+		if (size_t sz = 0; mMsgPackReader.ReadBinarySize(sz)) {
+			return std::make_optional<CMsgPackReadBinaryScope<TReader>>(sz, &mMsgPackReader, GetContext());
 		}
 		return std::nullopt;
 	}
 
+	/**
+	 * @brief Checks whether there are more root values in the input (for reading a sequence of documents).
+	 */
+	[[nodiscard]] bool HasMoreValues()
+	{
+		return mMsgPackReader.HasMoreData();
+	}
+
 	static constexpr void Finalize() noexcept { /* Not required */ }
 
 private:
-	IMsgPackReader* mMsgPackReader = nullptr;
+	TReader mMsgPackReader;
 };
 
 }
@@ -969,12 +2075,33 @@ private:
  * @brief MsgPack archive.
  *
  * Supports load/save from:
- * - `std::string`
+ * - `std::string` (save also to strings with custom allocators, e.g. `std::pmr::string`)
  * - `std::istream` and `std::ostream`
+ * - `FixedOutputBuffer` (only save, the buffer with fixed capacity provided by caller)
+ * - `SegmentedInput` (only load, the sequence of segments, e.g. the message received into several network buffers)
+ *
+ * The root scopes are bound to the concrete reader/writer for each kind of input/output data,
+ * so all nested scopes call them directly (without virtual dispatch).
  */
-using MsgPackArchive = TArchiveBase<
+class MsgPackArchive final : public TArchiveBase<
 	Detail::MsgPackArchiveTraits,
-	Detail::MsgPackReadRootScope,
-	Detail::MsgPackWriteRootScope>;
+	Detail::CMsgPackReadRootScope<Detail::CMsgPackStringReader>,
+	Detail::CMsgPackWriteRootScope<Detail::CMsgPackStringWriter>>
+{
+public:
+	template <typename TInput>
+	using input_archive_for = Detail::CMsgPackReadRootScope<
+		std::conditional_t<is_input_stream_v<TInput>, Detail::CMsgPackStreamReader,
+		std::conditional_t<std::is_same_v<TInput, SegmentedInput>, Detail::CMsgPackSegmentedReader, Detail::CMsgPackStringReader>>>;
+
+	template <typename TOutput>
+	using output_archive_for = Detail::CMsgPackWriteRootScope<
+		std::conditional_t<is_output_stream_v<TOutput>, Detail::CMsgPackStreamWriter,
+		std::conditional_t<std::is_same_v<TOutput, FixedOutputBuffer>, Detail::CMsgPackBufferWriter,
+		std::conditional_t<std::is_same_v<TOutput, std::string>, Detail::CMsgPackStringWriter, Detail::CMsgPackStringRefWriter>>>>;
+
+	/// Root scope for measuring the size of encoded data (see `MeasureObject()`).
+	using measure_archive_type = Detail::CMsgPackWriteRootScope<Detail::CMsgPackSizeWriter>;
+};
 
 } // namespace BitSerializer::MsgPack
@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <istream>
+#include "bitserializer/bit_serializer.h"
+#include "bitserializer/msgpack_archive.h"
+
+namespace BitSerializer::MsgPack
+{
+	/**
+	 * @brief Reads a sequence of MsgPack documents which are stored one after another in the stream (like log or replay files).
+	 *
+	 * The stream reader and its read-ahead buffer are kept between documents, so the memory usage does not depend
+	 * on the number of documents. The reader can't continue after a parsing error (the position in the stream is undefined).
+	 *
+	 * Usage example:
+	 * @code
+	 * std::ifstream file("events.log", std::ios::binary);
+	 * MsgPackStreamDocumentReader reader(file);
+	 * for (TEvent event; reader.ReadNext(event);) {
+	 *     Process(event);
+	 * }
+	 * @endcode
+	 */
+	class MsgPackStreamDocumentReader
+	{
+	public:
+		/**
+		 * @brief Creates the reader (the stream should be alive while the reader is used).
+		 *
+		 * @param inputStream The input stream.
+		 * @param serializationOptions The serialization options (applied to all documents).
+		 */
+		explicit MsgPackStreamDocumentReader(std::istream& inputStream, const SerializationOptions& serializationOptions = DefaultOptions)
+			: mSerializationOptions(serializationOptions)
+			, mSerializationContext(mSerializationOptions)
+			, mRootScope(inputStream, mSerializationContext)
+		{ }
+
+		MsgPackStreamDocumentReader(MsgPackStreamDocumentReader&&) = delete;
+		MsgPackStreamDocumentReader& operator=(MsgPackStreamDocumentReader&&) = delete;
+		MsgPackStreamDocumentReader(const MsgPackStreamDocumentReader&) = delete;
+		MsgPackStreamDocumentReader& operator=(const MsgPackStreamDocumentReader&) = delete;
+		~MsgPackStreamDocumentReader() = default;
+
+		/**
+		 * @brief Loads the next document into the object.
+		 *
+		 * @param[out] value The object to load.
+		 * @return `false` when there are no more documents in the stream.
+		 * @throws SerializationException When the document can't be loaded (including `ValidationException`).
+		 */
+		template <typename TValue>
+		bool ReadNext(TValue&& value)
+		{
+			if (!mRootScope.HasMoreValues()) {
+				return false;
+			}
+			KeyValueProxy::SplitAndSerialize(mRootScope, std::forward<TValue>(value));
+			mRootScope.Finalize();
+			mSerializationContext.OnFinishSerialization();
+			return true;
+		}
+
+	private:
+		SerializationOptions mSerializationOptions;
+		SerializationContext mSerializationContext;
+		Detail::CMsgPackReadRootScope<Detail::CMsgPackStreamReader> mRootScope;
+	};
+}
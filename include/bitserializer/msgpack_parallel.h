@@ -0,0 +1,306 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "bitserializer/bit_serializer.h"
+#include "bitserializer/msgpack_archive.h"
+#include "bitserializer/types/std/vector.h"
+
+namespace BitSerializer::MsgPack
+{
+	namespace Detail
+	{
+		/**
+		 * @brief Returns the number of threads for processing specified number of items (0 means the number of hardware threads).
+		 */
+		inline size_t GetThreadsCount(size_t threadsCount, size_t itemsCount, size_t minItemsPerThread) noexcept
+		{
+			if (threadsCount == 0) {
+				threadsCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+			}
+			return (std::min)(threadsCount, (std::max)(itemsCount / minItemsPerThread, size_t(1)));
+		}
+
+		/**
+		 * @brief Calls the function with index of thread in specified number of threads (including the current one) and waits for all of them.
+		 *
+		 * The function should not throw exceptions (they should be passed to the calling thread via `std::exception_ptr`).
+		 */
+		template <typename TFunc>
+		void RunInThreads(size_t threadsCount, TFunc&& fn)
+		{
+			std::vector<std::thread> threads;
+			threads.reserve(threadsCount - 1);
+			const auto joinThreads = [&threads]()
+			{
+				for (auto& thread : threads) {
+					thread.join();
+				}
+			};
+			try
+			{
+				for (size_t threadIndex = 1; threadIndex < threadsCount; ++threadIndex) {
+					threads.emplace_back(fn, threadIndex);
+				}
+			}
+			catch (...)
+			{
+				joinThreads();
+				throw;
+			}
+			fn(size_t(0));
+			joinThreads();
+		}
+
+		/**
+		 * @brief Stores the index if it is less than the current one (used for tracking the first failed item).
+		 */
+		inline void StoreMinIndex(std::atomic_size_t& minIndex, size_t index) noexcept
+		{
+			size_t currentIndex = minIndex.load(std::memory_order_relaxed);
+			while (index < currentIndex && !minIndex.compare_exchange_weak(currentIndex, index, std::memory_order_relaxed)) {}
+		}
+	}
+
+	/**
+	 * @brief Loads the root array of MsgPack document into `std::vector` using multiple threads.
+	 *
+	 * At first, boundaries of all items are found by fast skipping (without decoding), then contiguous slices
+	 * of items are loaded in parallel (each item via separate archive). Validation errors of all items are merged
+	 * and thrown as one `ValidationException` (paths of errors are prefixed with the index of item, e.g. "/17/name").
+	 * Small arrays, typed arrays and other types of root value are loaded in the current thread.
+	 *
+	 * @param values The vector to load (resized to the number of items, type of items should be default constructible).
+	 * @param data The MsgPack document with array at the root.
+	 * @param serializationOptions The serialization options.
+	 * @param threadsCount The number of threads (0 means the number of hardware threads).
+	 * @throws SerializationException When the document can't be loaded (the first error in order of items).
+	 */
+	template <typename T, typename TAllocator>
+	void LoadArrayInParallel(std::vector<T, TAllocator>& values, std::string_view data,
+		const SerializationOptions& serializationOptions = DefaultOptions, size_t threadsCount = 0)
+	{
+		// Items of `std::vector<bool>` can't be written from different threads
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			BitSerializer::LoadObject<MsgPackArchive>(values, data, serializationOptions);
+		}
+		else
+		{
+			// Minimum number of items per thread (decoding of smaller slices does not pay for starting a thread)
+			constexpr size_t minItemsPerThread = 256;
+
+			Detail::CMsgPackStringReader reader(data, serializationOptions);
+			size_t itemsCount = 0;
+			if (auto itemType = Detail::TypedArrayItemType::None; reader.ReadValueType() != Detail::ValueType::Array
+				|| !reader.ReadArraySize(itemsCount, itemType) || itemType != Detail::TypedArrayItemType::None)
+			{
+				BitSerializer::LoadObject<MsgPackArchive>(values, data, serializationOptions);
+				return;
+			}
+
+			threadsCount = Detail::GetThreadsCount(threadsCount, itemsCount, minItemsPerThread);
+			if (threadsCount == 1)
+			{
+				BitSerializer::LoadObject<MsgPackArchive>(values, data, serializationOptions);
+				return;
+			}
+
+			// Each item takes at least one byte, so the size from untrusted header is checked before allocating memory
+			if (itemsCount > data.size() - reader.GetPosition())
+			{
+				throw ParsingException("The size of array exceeds the size of input data: " + Convert::ToString(itemsCount),
+					0, reader.GetPosition());
+			}
+
+			// Find boundaries of items (the last offset is the end of array)
+			std::vector<size_t> offsets;
+			offsets.reserve(itemsCount + 1);
+			for (size_t i = 0; i < itemsCount; ++i)
+			{
+				offsets.push_back(reader.GetPosition());
+				reader.SkipValue();
+			}
+			offsets.push_back(reader.GetPosition());
+			values.resize(itemsCount);
+
+			struct SliceResult
+			{
+				ValidationMap ValidationErrors;
+				std::exception_ptr Exception;
+			};
+			std::vector<SliceResult> sliceResults(threadsCount);
+			// Items after the first failed one are skipped, but all items before it are loaded (to find the first error)
+			std::atomic_size_t failedIndex = itemsCount;
+
+			// Items are split to contiguous slices (the last one also includes the remainder)
+			const size_t sliceSize = itemsCount / threadsCount;
+			Detail::RunInThreads(threadsCount, [&](size_t sliceIndex)
+			{
+				auto& sliceResult = sliceResults[sliceIndex];
+				const size_t endIndex = sliceIndex + 1 == threadsCount ? itemsCount : (sliceIndex + 1) * sliceSize;
+				size_t i = sliceIndex * sliceSize;
+				try
+				{
+					for (; i < endIndex && i < failedIndex.load(std::memory_order_relaxed); ++i)
+					{
+						try
+						{
+							BitSerializer::LoadObject<MsgPackArchive>(values[i], data.substr(offsets[i], offsets[i + 1] - offsets[i]), serializationOptions);
+						}
+						catch (ValidationException& ex)
+						{
+							const auto indexPath = Detail::MsgPackArchiveTraits::path_separator + Convert::ToString(i);
+							for (auto& [path, errors] : ex.TakeValidationErrors()) {
+								sliceResult.ValidationErrors.try_emplace(indexPath + path, std::move(errors));
+							}
+						}
+					}
+				}
+				catch (...)
+				{
+					sliceResult.Exception = std::current_exception();
+					Detail::StoreMinIndex(failedIndex, i);
+				}
+			});
+
+			ValidationMap validationErrors;
+			for (auto& sliceResult : sliceResults)
+			{
+				if (sliceResult.Exception) {
+					std::rethrow_exception(sliceResult.Exception);
+				}
+				validationErrors.merge(sliceResult.ValidationErrors);
+			}
+			if (!validationErrors.empty()) {
+				throw ValidationException(std::move(validationErrors));
+			}
+		}
+	}
+
+	/**
+	 * @brief Saves `std::vector` as the root array of MsgPack document using multiple threads.
+	 *
+	 * Items are split to chunks which are saved in parallel into separate buffers (each item via separate archive),
+	 * then buffers are concatenated in order of items after the array header. The output is identical to `SaveObject()`,
+	 * but the whole encoded array is kept in memory until all chunks are saved. Small arrays and arrays of scalar types (which are saved by blocks) are saved in the current thread.
+	 *
+	 * @param values The vector to save.
+	 * @param output The output string (data is appended) or stream.
+	 * @param serializationOptions The serialization options.
+	 * @param threadsCount The number of threads (0 means the number of hardware threads).
+	 * @param chunkSize The number of items per chunk (0 means automatic).
+	 * @throws SerializationException When the array can't be saved (the first error in order of items).
+	 */
+	template <typename T, typename TAllocator, typename TOutput>
+	void SaveArrayInParallel(const std::vector<T, TAllocator>& values, TOutput& output,
+		const SerializationOptions& serializationOptions = DefaultOptions, size_t threadsCount = 0, size_t chunkSize = 0)
+	{
+		static_assert(std::is_same_v<TOutput, std::string> || std::is_base_of_v<std::ostream, TOutput>,
+			"BitSerializer. The output should be `std::string` or `std::ostream`.");
+
+		// Minimum number of items per thread (encoding of smaller chunks does not pay for starting a thread)
+		constexpr size_t minItemsPerThread = 256;
+
+		const size_t itemsCount = values.size();
+		if constexpr (std::is_class_v<T>)
+		{
+			threadsCount = Detail::GetThreadsCount(threadsCount, itemsCount, minItemsPerThread);
+		}
+		else
+		{
+			threadsCount = 1;
+		}
+		if (threadsCount == 1)
+		{
+			BitSerializer::SaveObject<MsgPackArchive>(values, output, serializationOptions);
+			return;
+		}
+
+		// By default, each thread gets several chunks for balancing items with different size
+		if (chunkSize == 0) {
+			chunkSize = (std::max)((itemsCount + threadsCount * 4 - 1) / (threadsCount * 4), minItemsPerThread);
+		}
+		const size_t chunksCount = (itemsCount + chunkSize - 1) / chunkSize;
+		threadsCount = (std::min)(threadsCount, chunksCount);
+
+		struct ChunkResult
+		{
+			std::string Data;
+			std::exception_ptr Exception;
+		};
+		std::vector<ChunkResult> chunkResults(chunksCount);
+		std::atomic_size_t nextChunkIndex = 0;
+		// Chunks after the first failed one are skipped, but all chunks before it are saved (to find the first error)
+		std::atomic_size_t failedChunkIndex = chunksCount;
+
+		Detail::RunInThreads(threadsCount, [&](size_t)
+		{
+			for (size_t chunkIndex = nextChunkIndex++; chunkIndex < failedChunkIndex.load(std::memory_order_relaxed); chunkIndex = nextChunkIndex++)
+			{
+				auto& chunkResult = chunkResults[chunkIndex];
+				try
+				{
+					SerializationContext context(serializationOptions);
+					const size_t endIndex = (std::min)((chunkIndex + 1) * chunkSize, itemsCount);
+					for (size_t i = chunkIndex * chunkSize; i < endIndex; ++i)
+					{
+						Detail::CMsgPackWriteRootScope<Detail::CMsgPackStringWriter> archive(chunkResult.Data, context);
+						KeyValueProxy::SplitAndSerialize(archive, values[i]);
+						archive.Finalize();
+					}
+					context.OnFinishSerialization();
+				}
+				catch (...)
+				{
+					chunkResult.Exception = std::current_exception();
+					Detail::StoreMinIndex(failedChunkIndex, chunkIndex);
+				}
+			}
+		});
+
+		for (const auto& chunkResult : chunkResults)
+		{
+			if (chunkResult.Exception) {
+				std::rethrow_exception(chunkResult.Exception);
+			}
+		}
+
+		// Write the array header and concatenate chunks (buffers are released as soon as they are written)
+		std::string header;
+		Detail::CMsgPackStringWriter(header, serializationOptions).BeginArray(itemsCount);
+		if constexpr (std::is_same_v<TOutput, std::string>)
+		{
+			size_t totalSize = header.size();
+			for (const auto& chunkResult : chunkResults) {
+				totalSize += chunkResult.Data.size();
+			}
+			output.reserve(output.size() + totalSize);
+			output.append(header);
+			for (auto& chunkResult : chunkResults)
+			{
+				output.append(chunkResult.Data);
+				std::string().swap(chunkResult.Data);
+			}
+		}
+		else
+		{
+			output.write(header.data(), static_cast<std::streamsize>(header.size()));
+			for (auto& chunkResult : chunkResults)
+			{
+				output.write(chunkResult.Data.data(), static_cast<std::streamsize>(chunkResult.Data.size()));
+				std::string().swap(chunkResult.Data);
+			}
+		}
+	}
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <string>
+#include <string_view>
+#include "bitserializer/bit_serializer.h"
+#include "bitserializer/msgpack_archive.h"
+
+namespace BitSerializer::MsgPack
+{
+	/**
+	 * @brief The result of feeding data to `MsgPackPushReader`.
+	 */
+	enum class MsgPackFeedResult
+	{
+		NeedMoreData,
+		ValueReady
+	};
+
+	/**
+	 * @brief Incremental (push-style) reader of MsgPack values which are received in parts (e.g. from non-blocking socket).
+	 *
+	 * Received data is buffered until the whole top-level value arrives, then it is loaded via MsgPack archive.
+	 * The state of searching the end of value is kept between calls of `Feed()`, so the data is scanned only once.
+	 *
+	 * Usage example:
+	 * @code
+	 * MsgPackPushReader reader;
+	 * void OnReceive(std::string_view chunk)
+	 * {
+	 *     if (reader.Feed(chunk) == MsgPackFeedResult::ValueReady) {
+	 *         for (TMessage message; reader.ReadNext(message);) {
+	 *             Process(message);
+	 *         }
+	 *     }
+	 * }
+	 * @endcode
+	 */
+	class MsgPackPushReader
+	{
+	public:
+		/// The default maximum size of one message (value), protects from buffering endless or corrupted data.
+		static constexpr size_t default_max_message_size = 64 * 1024 * 1024;
+
+		/**
+		 * @param serializationOptions The options for loading values.
+		 * @param maxMessageSize       The maximum size of one message (value), `std::numeric_limits<size_t>::max()` for unlimited.
+		 */
+		explicit MsgPackPushReader(const SerializationOptions& serializationOptions = DefaultOptions,
+			size_t maxMessageSize = default_max_message_size)
+			: mSerializationOptions(serializationOptions)
+			, mMaxMessageSize(maxMessageSize)
+			, mValueScanner(maxMessageSize)
+		{ }
+
+		/**
+		 * @brief Appends the received part of data.
+		 *
+		 * @return `MsgPackFeedResult::ValueReady` when at least one complete value is available for reading.
+		 * @throws ParsingException When the size of message exceeds the maximum, the buffered data is dropped
+		 *         (the stream can't be resynchronized, so the connection should be closed).
+		 */
+		MsgPackFeedResult Feed(std::string_view data)
+		{
+			// Drop already loaded values before appending new data
+			if (mValueOffset != 0)
+			{
+				mBuffer.erase(0, mValueOffset);
+				mValueOffset = 0;
+			}
+			mBuffer.append(data);
+
+			if (HasValue()) {
+				return MsgPackFeedResult::ValueReady;
+			}
+			// All buffered data belongs to the incomplete value
+			if (mBuffer.size() > mMaxMessageSize)
+			{
+				Reset();
+				throw ParsingException("The size of message exceeds the maximum size");
+			}
+			return MsgPackFeedResult::NeedMoreData;
+		}
+
+		/**
+		 * @brief Checks whether the complete value is available for reading.
+		 *
+		 * @throws ParsingException When the declared size of value exceeds the maximum size of message,
+		 *         the buffered data is dropped.
+		 */
+		[[nodiscard]] bool HasValue()
+		{
+			if (mValueSize == 0)
+			{
+				try {
+					mValueSize = mValueScanner.Scan(std::string_view(mBuffer).substr(mValueOffset));
+				}
+				catch (const ParsingException&)
+				{
+					Reset();
+					throw;
+				}
+			}
+			return mValueSize != 0;
+		}
+
+		/**
+		 * @brief Loads the next complete value into the object.
+		 *
+		 * The value is consumed even when loading fails, so reading can be continued from the next one.
+		 *
+		 * @param[out] value The object to load.
+		 * @return `false` when more data is needed.
+		 * @throws SerializationException When the value can't be loaded (including `ValidationException`).
+		 */
+		template <typename TValue>
+		bool ReadNext(TValue&& value)
+		{
+			if (!HasValue()) {
+				return false;
+			}
+
+			const auto valueData = std::string_view(mBuffer).substr(mValueOffset, mValueSize);
+			mValueOffset += mValueSize;
+			mValueSize = 0;
+			mValueScanner.Reset();
+			BitSerializer::LoadObject<MsgPackArchive>(std::forward<TValue>(value), valueData, mSerializationOptions);
+			return true;
+		}
+
+		/**
+		 * @brief Returns the size of buffered data which is not loaded yet.
+		 */
+		[[nodiscard]] size_t GetBufferedSize() const noexcept
+		{
+			return mBuffer.size() - mValueOffset;
+		}
+
+		/**
+		 * @brief Drops all buffered data (e.g. when connection is reset).
+		 */
+		void Reset() noexcept
+		{
+			mBuffer.clear();
+			mValueOffset = 0;
+			mValueSize = 0;
+			mValueScanner.Reset();
+		}
+
+	private:
+		SerializationOptions mSerializationOptions;
+		size_t mMaxMessageSize;
+		Detail::CMsgPackValueScanner mValueScanner;
+		std::string mBuffer;
+		// Offset of the current value in the buffer
+		size_t mValueOffset = 0;
+		// Size of the current value (0 when it is not received yet)
+		size_t mValueSize = 0;
+	};
+}
@@ -0,0 +1,311 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <charconv>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "bitserializer/bit_serializer.h"
+#include "bitserializer/msgpack_archive.h"
+
+namespace BitSerializer::MsgPack
+{
+	/**
+	 * @brief Read-only view of the MsgPack document with random access to nested values.
+	 *
+	 * Offsets of items are indexed on demand, only for accessed arrays and maps and only up to the requested item,
+	 * other values are just skipped (without decoding). Any node can be loaded into a C++ type via `Load()` or forwarded as is via `GetRawData()`.
+	 *
+	 * Usage example:
+	 * @code
+	 * const MsgPackView view(data);
+	 * const auto price = view["orders"][17]["price"].As<double>();
+	 * @endcode
+	 *
+	 * All views of the document share the same index, so they are not thread-safe. Views are valid while the input data is alive.
+	 * Typed arrays (see `SerializationOptions::useTypedArrays`) are not indexed, but can be loaded as a whole.
+	 */
+	class MsgPackView
+	{
+	public:
+		using ValueType = Detail::ValueType;
+
+		/**
+		 * @brief Creates the view of the root value.
+		 *
+		 * @param data The MsgPack document (should be alive while any view of it is used).
+		 * @param serializationOptions The options which are used for loading values.
+		 */
+		explicit MsgPackView(std::string_view data, const SerializationOptions& serializationOptions = {})
+			: mDocument(std::make_shared<Document>(data, serializationOptions))
+			, mOffset(0)
+			, mSize(data.size())
+		{ }
+
+		/**
+		 * @brief Returns the type of value.
+		 */
+		[[nodiscard]] ValueType GetValueType() const
+		{
+			return MakeReader().ReadValueType();
+		}
+
+		[[nodiscard]] bool IsArray() const {
+			return GetValueType() == ValueType::Array;
+		}
+
+		[[nodiscard]] bool IsMap() const {
+			return GetValueType() == ValueType::Map;
+		}
+
+		/**
+		 * @brief Returns the number of items in the array or map (0 for other types).
+		 */
+		[[nodiscard]] size_t GetSize() const
+		{
+			if (const auto valueType = GetValueType(); valueType == ValueType::Array || valueType == ValueType::Map)
+			{
+				const auto& itemsIndex = GetItemsIndex();
+				return valueType == ValueType::Map ? itemsIndex.ItemsCount / 2 : itemsIndex.ItemsCount;
+			}
+			return 0;
+		}
+
+		/**
+		 * @brief Returns the encoded value (can be forwarded without re-encoding).
+		 */
+		[[nodiscard]] std::string_view GetRawData() const noexcept
+		{
+			return mDocument->Data.substr(mOffset, mSize);
+		}
+
+		/**
+		 * @brief Returns the item of array.
+		 *
+		 * @throws SerializationException When the value is not an array or index is out of range.
+		 */
+		[[nodiscard]] MsgPackView operator[](size_t index) const
+		{
+			if (!IsArray()) {
+				throw SerializationException(SerializationErrorCode::MismatchedTypes, "MsgPack value is not an array");
+			}
+			auto& itemsIndex = GetItemsIndex();
+			if (index >= itemsIndex.ItemsCount) {
+				throw SerializationException(SerializationErrorCode::OutOfRange, "Index is out of range of MsgPack array: " + Convert::ToString(index));
+			}
+			return GetIndexedItem(itemsIndex, index);
+		}
+
+		/**
+		 * @brief Returns the value of map by string key.
+		 *
+		 * @throws SerializationException When the value is not a map or key is not found.
+		 */
+		[[nodiscard]] MsgPackView operator[](std::string_view key) const
+		{
+			if (auto value = Find(key)) {
+				return *value;
+			}
+			if (!IsMap()) {
+				throw SerializationException(SerializationErrorCode::MismatchedTypes, "MsgPack value is not a map");
+			}
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Key is not found in MsgPack map: " + std::string(key));
+		}
+
+		/**
+		 * @brief Finds the value of map by string key, returns `std::nullopt` when the key is not found or the value is not a map.
+		 */
+		[[nodiscard]] std::optional<MsgPackView> Find(std::string_view key) const
+		{
+			if (!IsMap()) {
+				return std::nullopt;
+			}
+
+			// Items are indexed only until the key is found
+			auto& itemsIndex = GetItemsIndex();
+			auto reader = MakeReader();
+			for (size_t i = 0; i < itemsIndex.ItemsCount; i += 2)
+			{
+				IndexItems(itemsIndex, i + 1);
+				reader.SetPosition(itemsIndex.Offsets[i]);
+				if (std::string_view itemKey; reader.ReadValueType() == ValueType::String && reader.ReadValue(itemKey) && itemKey == key) {
+					return GetIndexedItem(itemsIndex, i + 1);
+				}
+			}
+			return std::nullopt;
+		}
+
+		/**
+		 * @brief Finds the value by path (for example "/orders/17/price"), returns `std::nullopt` when the value is not found.
+		 *
+		 * The path has the same format as returned by `GetPath()` of archive scopes.
+		 */
+		[[nodiscard]] std::optional<MsgPackView> FindPath(std::string_view path) const
+		{
+			std::optional<MsgPackView> node(*this);
+			while (!path.empty() && node)
+			{
+				if (path.front() == Detail::MsgPackArchiveTraits::path_separator)
+				{
+					path.remove_prefix(1);
+					continue;
+				}
+				const auto segment = path.substr(0, path.find(Detail::MsgPackArchiveTraits::path_separator));
+				path.remove_prefix(segment.size());
+
+				if (node->IsArray())
+				{
+					size_t index = 0;
+					const auto [ptr, ec] = std::from_chars(segment.data(), segment.data() + segment.size(), index);
+					if (ec != std::errc() || ptr != segment.data() + segment.size() || index >= node->GetSize()) {
+						return std::nullopt;
+					}
+					node = (*node)[index];
+				}
+				else {
+					node = node->Find(segment);
+				}
+			}
+			return node;
+		}
+
+		/**
+		 * @brief Returns the key of map item by its index (items are in the same order as stored in the document).
+		 */
+		[[nodiscard]] MsgPackView GetKey(size_t index) const
+		{
+			return GetMapItem(index * 2);
+		}
+
+		/**
+		 * @brief Returns the value of map item by its index (items are in the same order as stored in the document).
+		 */
+		[[nodiscard]] MsgPackView GetValue(size_t index) const
+		{
+			return GetMapItem(index * 2 + 1);
+		}
+
+		/**
+		 * @brief Loads the value into the C++ object (via the MsgPack archive).
+		 */
+		template <typename T>
+		void Load(T&& value) const
+		{
+			BitSerializer::LoadObject<MsgPackArchive>(std::forward<T>(value), GetRawData(), mDocument->Options);
+		}
+
+		/**
+		 * @brief Loads and returns the value of specified type.
+		 */
+		template <typename T>
+		[[nodiscard]] T As() const
+		{
+			T value{};
+			Load(value);
+			return value;
+		}
+
+	private:
+		struct ItemsIndex
+		{
+			// The number of items (keys and values of map are counted separately)
+			size_t ItemsCount = 0;
+			// Offsets of already indexed items, the last one is the end of the last indexed item
+			std::vector<size_t> Offsets;
+		};
+
+		struct Document
+		{
+			Document(std::string_view data, const SerializationOptions& options)
+				: Data(data)
+				, Options(options)
+			{ }
+
+			std::string_view Data;
+			SerializationOptions Options;
+			// Indexes of accessed arrays and maps (by offset of their headers)
+			std::unordered_map<size_t, ItemsIndex> ItemsIndexes;
+		};
+
+		MsgPackView(std::shared_ptr<Document> document, size_t offset, size_t size) noexcept
+			: mDocument(std::move(document))
+			, mOffset(offset)
+			, mSize(size)
+		{ }
+
+		[[nodiscard]] Detail::CMsgPackStringReader MakeReader() const
+		{
+			Detail::CMsgPackStringReader reader(mDocument->Data.substr(0, mOffset + mSize), mDocument->Options);
+			reader.SetPosition(mOffset);
+			return reader;
+		}
+
+		/**
+		 * @brief Returns the index of array or map (only the header is read when it is created).
+		 */
+		[[nodiscard]] ItemsIndex& GetItemsIndex() const
+		{
+			auto& itemsIndexes = mDocument->ItemsIndexes;
+			if (const auto it = itemsIndexes.find(mOffset); it != itemsIndexes.end()) {
+				return it->second;
+			}
+
+			auto reader = MakeReader();
+			ItemsIndex itemsIndex;
+			if (reader.ReadValueType() == ValueType::Map)
+			{
+				reader.ReadMapSize(itemsIndex.ItemsCount);
+				itemsIndex.ItemsCount *= 2;
+			}
+			else {
+				reader.ReadArraySize(itemsIndex.ItemsCount);
+			}
+			itemsIndex.Offsets.push_back(reader.GetPosition());
+			return itemsIndexes.emplace(mOffset, std::move(itemsIndex)).first->second;
+		}
+
+		/**
+		 * @brief Indexes items up to specified one (by skipping values which are not indexed yet).
+		 */
+		void IndexItems(ItemsIndex& itemsIndex, size_t lastItemIndex) const
+		{
+			if (itemsIndex.Offsets.size() <= lastItemIndex + 1)
+			{
+				auto reader = MakeReader();
+				reader.SetPosition(itemsIndex.Offsets.back());
+				while (itemsIndex.Offsets.size() <= lastItemIndex + 1)
+				{
+					reader.SkipValue();
+					itemsIndex.Offsets.push_back(reader.GetPosition());
+				}
+			}
+		}
+
+		[[nodiscard]] MsgPackView GetIndexedItem(ItemsIndex& itemsIndex, size_t itemIndex) const
+		{
+			IndexItems(itemsIndex, itemIndex);
+			const auto& offsets = itemsIndex.Offsets;
+			return { mDocument, offsets[itemIndex], offsets[itemIndex + 1] - offsets[itemIndex] };
+		}
+
+		[[nodiscard]] MsgPackView GetMapItem(size_t itemIndex) const
+		{
+			if (!IsMap()) {
+				throw SerializationException(SerializationErrorCode::MismatchedTypes, "MsgPack value is not a map");
+			}
+			auto& itemsIndex = GetItemsIndex();
+			if (itemIndex >= itemsIndex.ItemsCount) {
+				throw SerializationException(SerializationErrorCode::OutOfRange, "Index is out of range of MsgPack map: " + Convert::ToString(itemIndex / 2));
+			}
+			return GetIndexedItem(itemsIndex, itemIndex);
+		}
+
+		std::shared_ptr<Document> mDocument;
+		size_t mOffset;
+		size_t mSize;
+	};
+}
@@ -8,6 +8,7 @@
 #include <optional>
 #include <type_traits>
 #include <variant>
+#include "bitserializer/common/output_string_ref.h"
 #include "bitserializer/serialization_detail/archive_base.h"
 #include "bitserializer/serialization_detail/errors_handling.h"
 
@@ -56,6 +57,33 @@ protected:
 	~RapidJsonArchiveTraits() = default;
 };
 
+/**
+ * @brief RapidJson output stream which writes directly to the string referenced by `COutputStringRef`
+ * (used for strings with custom allocators, e.g. `std::pmr::string`).
+ */
+class COutputStringRefWrapper
+{
+public:
+	using Ch = char;
+
+	explicit COutputStringRefWrapper(BitSerializer::Detail::COutputStringRef& outputString) noexcept
+		: mOutputString(outputString)
+	{ }
+
+	void Put(Ch c) { mOutputString.push_back(c); }
+	void Flush() noexcept { }
+
+	// Not implemented (required only for input streams)
+	Ch Peek() const { assert(false); return 0; }
+	Ch Take() { assert(false); return 0; }
+	size_t Tell() const { assert(false); return 0; }
+	Ch* PutBegin() { assert(false); return nullptr; }
+	size_t PutEnd(Ch*) { assert(false); return 0; }
+
+private:
+	BitSerializer::Detail::COutputStringRef& mOutputString;
+};
+
 // Forward declarations
 template <SerializeMode TMode, class TEncoding, class TAllocator>
 class RapidJsonObjectScope;
@@ -583,6 +611,14 @@ public:
 		static_assert(TMode == SerializeMode::Save, "BitSerializer. This data type can be used only in 'Save' mode.");
 	}
 
+	RapidJsonRootScope(BitSerializer::Detail::COutputStringRef encodedOutputStr, SerializationContext& serializationContext)
+		: TArchiveScope<TMode>(serializationContext)
+		, RapidJsonScopeBase<TEncoding>(&mRootJson)
+		, mOutput(std::move(encodedOutputStr))
+	{
+		static_assert(TMode == SerializeMode::Save, "BitSerializer. This data type can be used only in 'Save' mode.");
+	}
+
 	RapidJsonRootScope(std::istream& encodedInputStream, SerializationContext& serializationContext)
 		: TArchiveScope<TMode>(serializationContext)
 		, RapidJsonScopeBase<TEncoding>(&mRootJson)
@@ -742,6 +778,23 @@ public:
 					}
 					*arg = buffer.GetString();
 				}
+				else if constexpr (std::is_same_v<T, BitSerializer::Detail::COutputStringRef>)
+				{
+					// Strings with custom allocators (e.g. `std::pmr::string`) are written directly, without intermediate buffer
+					arg.clear();
+					COutputStringRefWrapper osw(arg);
+					if (options.formatOptions.enableFormat)
+					{
+						rapidjson::PrettyWriter<COutputStringRefWrapper, TEncoding, rapidjson::UTF8<>> writer(osw);
+						writer.SetIndent(options.formatOptions.paddingChar, options.formatOptions.paddingCharNum);
+						mRootJson.Accept(writer);
+					}
+					else
+					{
+						rapidjson::Writer<COutputStringRefWrapper, TEncoding, rapidjson::UTF8<>> writer(osw);
+						mRootJson.Accept(writer);
+					}
+				}
 				else if constexpr (std::is_same_v<T, std::ostream*>)
 				{
 					rapidjson::OStreamWrapper osw(*arg);
@@ -788,7 +841,7 @@ private:
 	}
 
 	RapidJsonDocument mRootJson;
-	std::variant<decltype(nullptr), std::string*, std::ostream*> mOutput;
+	std::variant<decltype(nullptr), std::string*, BitSerializer::Detail::COutputStringRef, std::ostream*> mOutput;
 };
 
 }
@@ -798,7 +851,7 @@ private:
  * @brief JSON archive based on RapidJson library.
  *
  * Supports load/save from:
- * - `std::string`: UTF-8
+ * - `std::string`: UTF-8 (save also to strings with custom allocators, e.g. `std::pmr::string`)
  * - `std::istream`, `std::ostream`: UTF-8, UTF-16LE, UTF-16BE, UTF-32LE, UTF-32BE
  */
 using JsonArchive = TArchiveBase<
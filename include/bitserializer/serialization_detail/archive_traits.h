@@ -22,6 +22,54 @@ namespace BitSerializer
 	template <typename T>
 	constexpr bool is_archive_scope_v = is_archive_scope<T>::value;
 
+	/**
+	 * @brief Selects the root scope of archive for loading from a specific input data type.
+	 *
+	 * An archive can declare the `input_archive_for<TInput>` alias template to bind the root scope
+	 * to a concrete input type, otherwise is used the `input_archive_type`.
+	 *
+	 * @tparam TArchive The archive type.
+	 * @tparam TInput   The input data type (e.g., string, stream).
+	 */
+	template <typename TArchive, typename TInput, typename = void>
+	struct select_input_archive
+	{
+		using type = typename TArchive::input_archive_type;
+	};
+
+	template <typename TArchive, typename TInput>
+	struct select_input_archive<TArchive, TInput, std::void_t<typename TArchive::template input_archive_for<TInput>>>
+	{
+		using type = typename TArchive::template input_archive_for<TInput>;
+	};
+
+	template <typename TArchive, typename TInput>
+	using select_input_archive_t = typename select_input_archive<TArchive, TInput>::type;
+
+	/**
+	 * @brief Selects the root scope of archive for saving to a specific output data type.
+	 *
+	 * An archive can declare the `output_archive_for<TOutput>` alias template to bind the root scope
+	 * to a concrete output type, otherwise is used the `output_archive_type`.
+	 *
+	 * @tparam TArchive The archive type.
+	 * @tparam TOutput  The output data type (e.g., string, stream).
+	 */
+	template <typename TArchive, typename TOutput, typename = void>
+	struct select_output_archive
+	{
+		using type = typename TArchive::output_archive_type;
+	};
+
+	template <typename TArchive, typename TOutput>
+	struct select_output_archive<TArchive, TOutput, std::void_t<typename TArchive::template output_archive_for<TOutput>>>
+	{
+		using type = typename TArchive::template output_archive_for<TOutput>;
+	};
+
+	template <typename TArchive, typename TOutput>
+	using select_output_archive_t = typename select_output_archive<TArchive, TOutput>::type;
+
 	/**
 	 * @brief Determines if an archive supports a specific input data type.
 	 *
@@ -54,6 +102,41 @@ namespace BitSerializer
 	template <typename TArchive, typename TOutput>
 	constexpr bool is_archive_support_output_data_type_v = is_archive_support_output_data_type<TArchive, TOutput>::value;
 
+	/**
+	 * @brief Determines if an archive supports measuring the size of output data (see `MeasureObject()`).
+	 *
+	 * An archive can declare the `measure_archive_type` root scope, which is constructed from `size_t&`.
+	 *
+	 * @tparam TArchive The archive type being tested.
+	 */
+	template <typename TArchive, typename = void>
+	struct is_archive_support_measure : std::false_type {};
+
+	template <typename TArchive>
+	struct is_archive_support_measure<TArchive, std::void_t<typename TArchive::measure_archive_type>>
+		: std::is_constructible<typename TArchive::measure_archive_type, size_t&, SerializationContext&> {};
+
+	template <typename TArchive>
+	constexpr bool is_archive_support_measure_v = is_archive_support_measure<TArchive>::value;
+
+	/**
+	 * @brief Determines if an archive supports loading from memory-mapped files (see `LoadObjectFromFile()`).
+	 *
+	 * An archive can declare the `support_mapped_files` flag when it is built as a library with the implementation
+	 * of `CMappedFile` (the header-only archives load files via streams).
+	 *
+	 * @tparam TArchive The archive type being tested.
+	 */
+	template <typename TArchive, typename = void>
+	struct is_archive_support_mapped_files : std::false_type {};
+
+	template <typename TArchive>
+	struct is_archive_support_mapped_files<TArchive, std::void_t<decltype(TArchive::support_mapped_files)>>
+		: std::bool_constant<TArchive::support_mapped_files> {};
+
+	template <typename TArchive>
+	constexpr bool is_archive_support_mapped_files_v = is_archive_support_mapped_files<TArchive>::value;
+
 	/**
 	 * @brief Determines if a value (number or string) can be serialized using the specified archive.
 	 *
@@ -271,6 +354,34 @@ namespace BitSerializer
 	template <typename TArchive, typename TKey>
 	constexpr bool can_serialize_binary_with_key_v = can_serialize_binary_with_key<TArchive, TKey>::value;
 
+	/**
+	 * @brief Determines if the scope (binary or array) can serialize a block of values at once.
+	 *
+	 * Detects whether the scope provides a method matching:
+	 * `size_t SerializeBlock(TValue*, size_t)` which is used as fast path for contiguous containers
+	 * (bytes in binary scopes and numbers in array scopes).
+	 *
+	 * @tparam TArchive The scope type.
+	 * @tparam TValue   The type of value.
+	 */
+	template <typename TArchive, typename TValue>
+	struct can_serialize_block
+	{
+	private:
+		template <typename TObj>
+		static std::enable_if_t<std::is_same_v<decltype(std::declval<TObj&>().SerializeBlock(std::declval<TValue*>(), std::declval<size_t>())), size_t>, std::true_type> test(int);
+
+		template <typename>
+		static std::false_type test(...);
+
+	public:
+		typedef decltype(test<TArchive>(0)) type;
+		enum { value = type::value };
+	};
+
+	template <typename TArchive, typename TValue>
+	constexpr bool can_serialize_block_v = can_serialize_block<TArchive, TValue>::value;
+
 	/**
 	 * @brief Determines if the archive supports attribute serialization.
 	 *
@@ -297,6 +408,23 @@ namespace BitSerializer
 	template <typename TArchive>
 	constexpr bool can_serialize_attribute_v = can_serialize_attribute<TArchive>::value;
 
+	/**
+	 * @brief Determines if the scope should be closed explicitly after serializing an object.
+	 *
+	 * Detects whether the scope provides a method matching: `void Close()`, which completes the scope
+	 * and may throw an exception (e.g. when the number of written fields does not match the declared size).
+	 *
+	 * @tparam TScope The archive scope type.
+	 */
+	template <typename TScope, typename = void>
+	struct has_close_scope : std::false_type {};
+
+	template <typename TScope>
+	struct has_close_scope<TScope, std::void_t<decltype(std::declval<TScope&>().Close())>> : std::true_type {};
+
+	template <typename TScope>
+	constexpr bool has_close_scope_v = has_close_scope<TScope>::value;
+
 	/**
 	 * @brief Determines if a type is convertible to any element within a tuple.
 	 *
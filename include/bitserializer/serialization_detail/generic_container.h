@@ -3,7 +3,10 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <algorithm>
 #include <cstddef>
+#include "bitserializer/serialization_detail/object_traits.h"
+#include "bitserializer/serialization_detail/archive_traits.h"
 
 namespace BitSerializer::Detail
 {
@@ -21,6 +24,9 @@ namespace BitSerializer::Detail
 	 * When saving:
 	 * - Iterates through all elements and serializes them.
 	 *
+	 * Containers which store numbers in contiguous memory (like `std::vector<float>`) are serialized
+	 * as a single block when it is supported by the archive scope.
+	 *
 	 * @tparam TArchive    The archive type used for serialization.
 	 * @tparam TContainer  The container type to serialize.
 	 * @param arrayScope   Archive scope object used for serializing array content.
@@ -29,6 +35,33 @@ namespace BitSerializer::Detail
 	template<typename TArchive, typename TContainer>
 	static void SerializeContainer(TArchive& arrayScope, TContainer& cont)
 	{
+		if constexpr (is_contiguous_arithmetic_container_v<TContainer>)
+		{
+			using TValue = std::remove_pointer_t<decltype(cont.data())>;
+			if constexpr (can_serialize_block_v<TArchive, TValue>)
+			{
+				if constexpr (TArchive::IsLoading())
+				{
+					cont.resize(arrayScope.GetEstimatedSize());
+					size_t loadedItems = arrayScope.SerializeBlock(cont.data(), cont.size());
+
+					// Load remaining items (when the estimated size is less than the actual)
+					while (!arrayScope.IsEnd())
+					{
+						constexpr size_t minGrowSize = 64;
+						cont.resize(loadedItems + (std::max)(loadedItems, minGrowSize));
+						loadedItems += arrayScope.SerializeBlock(cont.data() + loadedItems, cont.size() - loadedItems);
+					}
+					cont.resize(loadedItems);
+				}
+				else
+				{
+					arrayScope.SerializeBlock(cont.data(), cont.size());
+				}
+				return;
+			}
+		}
+
 		if constexpr (TArchive::IsLoading())
 		{
 			// Resize container when approximate size is known
@@ -40,15 +40,44 @@ namespace BitSerializer::KeyValueProxy
 	template <class TArchive, class TKey, class TValue, class... TArgs>
 	static void SplitAndSerialize(TArchive& archive, KeyValue<TKey, TValue, TArgs...>&& keyValue)
 	{
+		const auto serializeByName = [&archive, &keyValue]()
+		{
+			if constexpr (BitSerializer::is_convertible_to_one_from_tuple_v<TKey, typename TArchive::supported_key_types>)
+			{
+				return Serialize(archive, keyValue.GetKey(), keyValue.GetValue());
+			}
+			else
+			{
+				const auto key = Convert::To<typename TArchive::key_type>(keyValue.GetKey());
+				return Serialize(archive, key, keyValue.GetValue());
+			}
+		};
+
 		bool result;
-		if constexpr (BitSerializer::is_convertible_to_one_from_tuple_v<TKey, typename TArchive::supported_key_types>)
+		if constexpr ((std::is_same_v<std::decay_t<TArgs>, FieldId> || ...)
+			&& BitSerializer::is_convertible_to_one_from_tuple_v<uint64_t, typename TArchive::supported_key_types>)
 		{
-			result = Serialize(archive, keyValue.GetKey(), keyValue.GetValue());
+			// Archives which support integer keys store the id of field instead of its name
+			uint64_t fieldId = 0;
+			keyValue.VisitArgs([&fieldId](auto& arg)
+			{
+				if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, FieldId>) {
+					fieldId = arg.Id;
+				}
+			});
+			result = Serialize(archive, fieldId, keyValue.GetValue());
+
+			// Try to find by name when the value was saved without id
+			if constexpr (TArchive::IsLoading())
+			{
+				if (!result) {
+					result = serializeByName();
+				}
+			}
 		}
 		else
 		{
-			const auto key = Convert::To<typename TArchive::key_type>(keyValue.GetKey());
-			result = Serialize(archive, key, keyValue.GetValue());
+			result = serializeByName();
 		}
 
 		// Handle validation only during loading
@@ -59,7 +88,8 @@ namespace BitSerializer::KeyValueProxy
 				using HandlerType = std::decay_t<decltype(handler)>;
 				constexpr auto isValidator = is_validator_v<HandlerType, TValue>;
 				constexpr auto isRefiner = is_refiner_v<HandlerType, TValue>;
-				static_assert(isValidator || isRefiner, "BitSerializer. Unknown signature of argument passed to KeyValue");
+				constexpr auto isFieldId = std::is_same_v<HandlerType, FieldId>;
+				static_assert(isValidator || isRefiner || isFieldId, "BitSerializer. Unknown signature of argument passed to KeyValue");
 
 				if constexpr (isValidator)
 				{
@@ -4,6 +4,8 @@
 *******************************************************************************/
 #pragma once
 #include <type_traits>
+#include <limits>
+#include <cstddef>
 #include <string>
 #include <optional>
 #include "bitserializer/serialization_detail/archive_base.h"
@@ -145,6 +147,27 @@ namespace BitSerializer {
 	template <typename T>
 	constexpr bool has_reserve_v = has_reserve<T>::value;
 
+	/**
+	 * @brief Checks whether a container has a `resize()` method.
+	 */
+	template <typename T>
+	struct has_resize
+	{
+	private:
+		template <typename U>
+		static decltype(std::declval<U>().resize(std::declval<size_t>()), std::true_type()) test(int);
+
+		template <typename>
+		static std::false_type test(...);
+
+	public:
+		using type = decltype(test<T>(0));
+		enum { value = type::value };
+	};
+
+	template <typename T>
+	constexpr bool has_resize_v = has_resize<T>::value;
+
 	/**
 	 * @brief Checks whether a type supports enumeration via `begin()` and `end()` methods.
 	 */
@@ -154,8 +177,8 @@ namespace BitSerializer {
 	private:
 		template <typename T>
 		static std::enable_if_t<
-			std::is_convertible_v<decltype(std::declval<T>().begin().operator*()), typename T::value_type>
-			&& std::is_convertible_v<decltype(std::declval<T>().end().operator*()), typename T::value_type>, std::true_type> test(int);
+			std::is_convertible_v<decltype(*std::declval<T>().begin()), typename T::value_type>
+			&& std::is_convertible_v<decltype(*std::declval<T>().end()), typename T::value_type>, std::true_type> test(int);
 
 	template <typename>
 		static std::false_type test(...);
@@ -190,13 +213,70 @@ namespace BitSerializer {
 	constexpr bool is_enumerable_of_v = is_enumerable_of<TContainer, TValue>::value;
 
 	/**
-	 * @brief Checks whether a container holds single-byte integer types.
+	 * @brief Checks whether a type is a single byte which can be stored in binary arrays.
+	 */
+	template <typename T>
+	constexpr bool is_binary_byte_v =
+		std::is_same_v<T, char> ||
+		std::is_same_v<T, signed char> ||
+		std::is_same_v<T, unsigned char> ||
+		std::is_same_v<T, std::byte>;
+
+	/**
+	 * @brief Checks whether a container holds single-byte types.
 	 */
 	template <typename TContainer>
 	constexpr auto is_binary_container =
 		is_enumerable_of_v<TContainer, char> ||
 		is_enumerable_of_v<TContainer, signed char> ||
-		is_enumerable_of_v<TContainer, unsigned char>;
+		is_enumerable_of_v<TContainer, unsigned char> ||
+		is_enumerable_of_v<TContainer, std::byte>;
+
+	/**
+	 * @brief Checks whether a container stores bytes in contiguous memory (provides `data()` and `size()` methods).
+	 */
+	template <typename TContainer>
+	struct is_contiguous_binary_container
+	{
+	private:
+		template <typename T>
+		static std::enable_if_t<std::is_pointer_v<decltype(std::declval<T&>().data())>
+			&& is_binary_byte_v<std::remove_pointer_t<decltype(std::declval<T&>().data())>>
+			&& has_size_v<T>, std::true_type> test(int);
+
+		template <typename>
+		static std::false_type test(...);
+
+	public:
+		using type = decltype(test<TContainer>(0));
+		enum { value = type::value };
+	};
+
+	template <typename TContainer>
+	constexpr bool is_contiguous_binary_container_v = is_contiguous_binary_container<TContainer>::value;
+
+	/**
+	 * @brief Checks whether a container stores arithmetic values in contiguous memory (provides `data()` and `size()` methods).
+	 */
+	template <typename TContainer>
+	struct is_contiguous_arithmetic_container
+	{
+	private:
+		template <typename T>
+		static std::enable_if_t<std::is_pointer_v<decltype(std::declval<T&>().data())>
+			&& std::is_arithmetic_v<std::remove_pointer_t<decltype(std::declval<T&>().data())>>
+			&& has_size_v<T>, std::true_type> test(int);
+
+		template <typename>
+		static std::false_type test(...);
+
+	public:
+		using type = decltype(test<TContainer>(0));
+		enum { value = type::value };
+	};
+
+	template <typename TContainer>
+	constexpr bool is_contiguous_arithmetic_container_v = is_contiguous_arithmetic_container<TContainer>::value;
 
 	/**
 	 * @brief Gets the size of a container using available methods.
@@ -215,6 +295,33 @@ namespace BitSerializer {
 		}
 	}
 
+	/**
+	 * @brief Declares the number of fields which are always serialized by the type (fixed shape).
+	 *
+	 * Saving to binary archives requires the number of object fields, which is counted by running of `Serialize()`
+	 * method (see `FieldsCountVisitor`). For types with fixed shape, the number of fields can be declared via the
+	 * `BITSERIALIZER_FIXED_FIELDS(N)` macro in the public section of class or by specialization of this template
+	 * (e.g. for types with global `SerializeObject()` function).
+	 */
+	template <typename T, typename = void>
+	struct fixed_fields_count {};
+
+	template <typename T>
+	struct fixed_fields_count<T, std::enable_if_t<std::is_same_v<decltype(std::declval<const T&>().bitserializer_fixed_fields_owner()), T>>>
+		: std::integral_constant<size_t, T::bitserializer_fixed_fields_count> {};
+
+	/**
+	 * @brief Checks whether a type has the declared number of fields (see `fixed_fields_count`).
+	 */
+	template <typename T, typename = void>
+	struct has_fixed_fields_count : std::false_type {};
+
+	template <typename T>
+	struct has_fixed_fields_count<T, std::void_t<decltype(fixed_fields_count<T>::value)>> : std::true_type {};
+
+	template <typename T>
+	constexpr bool has_fixed_fields_count_v = has_fixed_fields_count<T>::value;
+
 	/**
 	 * @brief Visitor used to count the number of fields in a serializable object.
 	 */
@@ -262,7 +369,12 @@ namespace BitSerializer {
 		template <class TBase>
 		FieldsCountVisitor& operator<<(BaseObject<TBase>&& value) noexcept
 		{
-			Count(value.Object);
+			if constexpr (has_fixed_fields_count_v<TBase>) {
+				Size += fixed_fields_count<TBase>::value;
+			}
+			else {
+				Count(value.Object);
+			}
 			return *this;
 		}
 
@@ -271,12 +383,33 @@ namespace BitSerializer {
 		const TArchive& Archive;
 	};
 
+	/**
+	 * @brief The size of object (map) which is not known before serialization.
+	 */
+	inline constexpr size_t unknown_size = (std::numeric_limits<size_t>::max)();
+
+	/**
+	 * @brief Checks whether an archive requires the number of object fields before writing them (`true` by default).
+	 *
+	 * Archives which can write the size of map after serializing the object (e.g. by patching its header)
+	 * should declare `static constexpr bool require_map_size = false`.
+	 */
+	template <typename TArchive, typename = void>
+	struct is_map_size_required : std::true_type {};
+
+	template <typename TArchive>
+	struct is_map_size_required<TArchive, std::void_t<decltype(TArchive::require_map_size)>>
+		: std::bool_constant<TArchive::require_map_size> {};
+
+	template <typename TArchive>
+	constexpr bool is_map_size_required_v = is_map_size_required<TArchive>::value;
+
 	/**
 	 * @brief Counts the number of fields in a serializable object or the size of a map-like structure.
 	 *
 	 * @param archive Reference to the archive instance.
 	 * @param obj Reference to the object being counted.
-	 * @return Number of fields, or zero if loading or text-based archive.
+	 * @return Number of fields, `unknown_size` if archive does not require it, or zero if loading or text-based archive.
 	 */
 	template <typename TArchive, typename TValue>
 	size_t CountMapObjectFields(const TArchive& archive, TValue& obj)
@@ -298,6 +431,13 @@ namespace BitSerializer {
 			if constexpr (isEnumerable) {
 				return GetContainerSize(obj);
 			}
+			else if constexpr (has_fixed_fields_count_v<TValue>) {
+				return fixed_fields_count<TValue>::value;
+			}
+			else if constexpr (!is_map_size_required_v<TArchive>) {
+				// Archive will calculate the number of fields while serializing the object
+				return unknown_size;
+			}
 			else {
 				return FieldsCountVisitor<TArchive>(archive).Count(obj);
 			}
@@ -428,3 +568,15 @@ namespace BitSerializer {
 	using compatible_fixed_t = typename compatible_fixed<T>::type;
 
 } // namespace BitSerializer
+
+/**
+ * @brief Declares the number of fields which are always serialized by the class (should be placed in the public section).
+ *
+ * Allows to skip counting the fields of object when saving to binary archives. Derived classes do not inherit
+ * this declaration, they must declare own number of fields (including fields of base class).
+ *
+ * @param fieldsCount The number of fields.
+ */
+#define BITSERIALIZER_FIXED_FIELDS(fieldsCount) \
+	static constexpr size_t bitserializer_fixed_fields_count = (fieldsCount); \
+	auto bitserializer_fixed_fields_owner() const -> std::remove_cv_t<std::remove_reference_t<decltype(*this)>>
@@ -3,6 +3,7 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include "bitserializer/serialization_detail/object_traits.h"
@@ -383,9 +384,102 @@ namespace BitSerializer
 		return Serialize(archive, value.GetUnderlyingValue());
 	}
 
+	//------------------------------------------------------------------------------
+	// Serialize binary arrays
+	//------------------------------------------------------------------------------
+
+	namespace Detail
+	{
+		/**
+		 * @brief Serializes a block of bytes with fixed size as a single operation (fast path for binary scopes).
+		 *
+		 * @param binaryScope Archive scope used for binary serialization.
+		 * @param data        Pointer to the first byte.
+		 * @param size        Number of bytes (all of them must be loaded).
+		 * @return true if serialization succeeded, false otherwise.
+		 */
+		template<typename TArchive, typename TValue>
+		bool SerializeFixedSizeBinaryBlock(TArchive& binaryScope, TValue* data, size_t size)
+		{
+			const size_t processedSize = binaryScope.SerializeBlock(data, size);
+			if constexpr (TArchive::IsLoading())
+			{
+				if (processedSize != size || !binaryScope.IsEnd())
+				{
+					throw SerializationException(SerializationErrorCode::OutOfRange,
+						"Target array with fixed size does not match the number of loading items");
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief Serializes a container of bytes via binary scope.
+		 *
+		 * Containers which store bytes in contiguous memory (like `std::vector<uint8_t>` or `std::array<std::byte, N>`)
+		 * are serialized as a single block when it is supported by the scope, otherwise `SerializeArray()` is used.
+		 *
+		 * @param binaryScope Archive scope used for binary serialization.
+		 * @param cont        Reference to the container being serialized.
+		 */
+		template<typename TArchive, typename TContainer>
+		void SerializeBinaryContainer(TArchive& binaryScope, TContainer& cont)
+		{
+			if constexpr (is_contiguous_binary_container_v<TContainer>)
+			{
+				using TValue = std::remove_pointer_t<decltype(cont.data())>;
+				if constexpr (can_serialize_block_v<TArchive, TValue>)
+				{
+					if constexpr (TArchive::IsSaving())
+					{
+						binaryScope.SerializeBlock(cont.data(), cont.size());
+					}
+					else if constexpr (has_resize_v<TContainer>)
+					{
+						// The size is declared in the input data, when the archive can't check it against the size of
+						// remaining input (e.g. loading from stream), the container grows in bounded steps while data arrives
+						constexpr size_t maxInitialSize = 64 * 1024;
+						const size_t declaredSize = binaryScope.GetEstimatedSize();
+						size_t loadedSize = 0;
+						cont.resize((std::min)(declaredSize, maxInitialSize));
+						while (true)
+						{
+							loadedSize += binaryScope.SerializeBlock(cont.data() + loadedSize, cont.size() - loadedSize);
+							if (loadedSize == declaredSize || binaryScope.IsEnd()) {
+								break;
+							}
+							cont.resize(loadedSize + (std::min)(declaredSize - loadedSize, loadedSize));
+						}
+						cont.resize(loadedSize);
+					}
+					else
+					{
+						SerializeFixedSizeBinaryBlock(binaryScope, cont.data(), cont.size());
+					}
+					return;
+				}
+			}
+			SerializeArray(binaryScope, cont);
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	// Serialize classes
 	//------------------------------------------------------------------------------
+
+	namespace Detail
+	{
+		/**
+		 * @brief Closes the object scope explicitly when it is supported, which allows to throw an exception from there.
+		 */
+		template <typename TScope>
+		void CloseScope(TScope& scope)
+		{
+			if constexpr (has_close_scope_v<TScope>) {
+				scope.Close();
+			}
+		}
+	}
 	template <class TArchive, typename TKey, typename TValue, std::enable_if_t<(std::is_class_v<TValue> || std::is_union_v<TValue>), int> = 0>
 	bool Serialize(TArchive& archive, TKey&& key, TValue& value)
 	{
@@ -419,8 +513,10 @@ namespace BitSerializer
 				{
 					const size_t mapSize = CountMapObjectFields(archive, value);
 					auto objectScope = archive.OpenObjectScope(std::forward<TKey>(key), mapSize);
-					if (objectScope) {
+					if (objectScope)
+					{
 						value.Serialize(*objectScope);
+						Detail::CloseScope(*objectScope);
 					}
 					return objectScope.has_value();
 				}
@@ -434,8 +530,10 @@ namespace BitSerializer
 				{
 					const size_t mapSize = CountMapObjectFields(archive, value);
 					auto objectScope = archive.OpenObjectScope(std::forward<TKey>(key), mapSize);
-					if (objectScope) {
+					if (objectScope)
+					{
 						SerializeObject(*objectScope, value);
+						Detail::CloseScope(*objectScope);
 					}
 					return objectScope.has_value();
 				}
@@ -465,7 +563,7 @@ namespace BitSerializer
 					auto binaryScope = archive.OpenBinaryScope(std::forward<TKey>(key), arraySize);
 					if (binaryScope)
 					{
-						SerializeArray(*binaryScope, value);
+						Detail::SerializeBinaryContainer(*binaryScope, value);
 						return true;
 					}
 				}
@@ -514,8 +612,10 @@ namespace BitSerializer
 				{
 					const size_t mapSize = CountMapObjectFields(archive, value);
 					auto objectScope = archive.OpenObjectScope(mapSize);
-					if (objectScope) {
+					if (objectScope)
+					{
 						value.Serialize(*objectScope);
+						Detail::CloseScope(*objectScope);
 					}
 					return objectScope.has_value();
 				}
@@ -529,8 +629,10 @@ namespace BitSerializer
 				{
 					const size_t mapSize = CountMapObjectFields(archive, value);
 					auto objectScope = archive.OpenObjectScope(mapSize);
-					if (objectScope) {
+					if (objectScope)
+					{
 						SerializeObject(*objectScope, value);
+						Detail::CloseScope(*objectScope);
 					}
 					return objectScope.has_value();
 				}
@@ -560,7 +662,7 @@ namespace BitSerializer
 					auto binaryScope = archive.OpenBinaryScope(arraySize);
 					if (binaryScope)
 					{
-						SerializeArray(*binaryScope, value);
+						Detail::SerializeBinaryContainer(*binaryScope, value);
 						return true;
 					}
 				}
@@ -630,6 +732,26 @@ namespace BitSerializer
 		template<typename TArchive, typename TIterator>
 		bool SerializeFixedSizeArray(TArchive& arrayScope, TIterator startIt, TIterator endIt)
 		{
+			// Arrays of numbers are serialized as a single block when it is supported by the archive scope
+			if constexpr (std::is_pointer_v<TIterator>)
+			{
+				using TValue = std::remove_pointer_t<TIterator>;
+				if constexpr (can_serialize_block_v<TArchive, TValue>)
+				{
+					const auto size = static_cast<size_t>(endIt - startIt);
+					const size_t processedSize = arrayScope.SerializeBlock(startIt, size);
+					if constexpr (TArchive::IsLoading())
+					{
+						if (processedSize != size || !arrayScope.IsEnd())
+						{
+							throw SerializationException(SerializationErrorCode::OutOfRange,
+								"Target array with fixed size does not match the number of loading items");
+						}
+					}
+					return true;
+				}
+			}
+
 			if constexpr (TArchive::IsLoading())
 			{
 				auto it = startIt;
@@ -660,15 +782,20 @@ namespace BitSerializer
 	{
 		constexpr auto hasArrayWithKeySupport = can_serialize_array_with_key_v<TArchive, TKey>;
 		constexpr auto hasBinaryWithKeySupport = TArchive::is_binary && can_serialize_binary_with_key_v<TArchive, TKey>;
-		constexpr auto isBinaryArray = std::is_same_v<TValue, char> || std::is_same_v<TValue, signed char> || std::is_same_v<TValue, unsigned char>;
+		constexpr auto isBinaryArray = is_binary_byte_v<TValue>;
 		static_assert(hasArrayWithKeySupport, "BitSerializer. The archive doesn't support serialize array with key on this level.");
 
 		// Try to serialize as binary first
 		if constexpr (hasBinaryWithKeySupport && isBinaryArray)
 		{
-			if (auto arrayScope = archive.OpenBinaryScope(std::forward<TKey>(key), ArraySize))
+			if (auto binaryScope = archive.OpenBinaryScope(std::forward<TKey>(key), ArraySize))
 			{
-				return Detail::SerializeFixedSizeArray(arrayScope.value(), std::begin(cont), std::end(cont));
+				if constexpr (can_serialize_block_v<typename decltype(binaryScope)::value_type, TValue>) {
+					return Detail::SerializeFixedSizeBinaryBlock(binaryScope.value(), cont, ArraySize);
+				}
+				else {
+					return Detail::SerializeFixedSizeArray(binaryScope.value(), std::begin(cont), std::end(cont));
+				}
 			}
 		}
 		if constexpr (hasArrayWithKeySupport)
@@ -686,15 +813,20 @@ namespace BitSerializer
 	{
 		constexpr auto hasArraySupport = can_serialize_array_v<TArchive>;
 		constexpr auto hasBinarySupport = TArchive::is_binary && can_serialize_binary_v<TArchive>;
-		constexpr auto isBinaryArray = std::is_same_v<TValue, char> || std::is_same_v<TValue, signed char> || std::is_same_v<TValue, unsigned char>;
+		constexpr auto isBinaryArray = is_binary_byte_v<TValue>;
 		static_assert(hasArraySupport, "BitSerializer. The archive doesn't support serialize array without key on this level.");
 
 		// Try to serialize as binary first
 		if constexpr (hasBinarySupport && isBinaryArray)
 		{
-			if (auto arrayScope = archive.OpenBinaryScope(ArraySize))
+			if (auto binaryScope = archive.OpenBinaryScope(ArraySize))
 			{
-				return Detail::SerializeFixedSizeArray(arrayScope.value(), std::begin(cont), std::end(cont));
+				if constexpr (can_serialize_block_v<typename decltype(binaryScope)::value_type, TValue>) {
+					return Detail::SerializeFixedSizeBinaryBlock(binaryScope.value(), cont, ArraySize);
+				}
+				else {
+					return Detail::SerializeFixedSizeArray(binaryScope.value(), std::begin(cont), std::end(cont));
+				}
 			}
 		}
 		if constexpr (hasArraySupport)
@@ -7,6 +7,7 @@
 #include <version>
 #endif
 #include <variant>
+#include <vector>
 #include "bitserializer/serialization_options.h"
 #include "bitserializer/serialization_detail/errors_handling.h"
 
@@ -84,6 +85,16 @@ namespace BitSerializer
 			return mStringValueBuffer.emplace<TString>();
 		}
 
+		/**
+		 * @brief Returns the sizes of objects which were counted while measuring the output data (see `MeasureObject()`).
+		 *
+		 * When the output is measured before saving (option `reserveExactSize`), both passes share the context,
+		 * so archives can write the exact size of each object before its fields (in the order of opening objects).
+		 */
+		[[nodiscard]] std::vector<size_t>& GetMeasuredObjectSizes() noexcept {
+			return mMeasuredObjectSizes;
+		}
+
 		/**
 		 * @brief Determines whether the current stack is being unwound due to an active exception.
 		 */
@@ -101,6 +112,7 @@ namespace BitSerializer
 
 		StringsVariant mStringValueBuffer;
 		ValidationMap mErrorsMap;
+		std::vector<size_t> mMeasuredObjectSizes;
 		const SerializationOptions& mSerializationOptions;
 		int mInitialUncaughtCount = std::uncaught_exceptions();
 	};
@@ -3,6 +3,7 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include "bitserializer/conversion_detail/convert_utf.h"
 
@@ -33,9 +34,9 @@ namespace BitSerializer
 	};
 
 	/**
-	 * @brief Configuration options for output stream behavior.
+	 * @brief Configuration options for stream behavior.
 	 *
-	 * Controls byte-level characteristics of the output stream, mostly relevant for text-based formats.
+	 * Controls byte-level characteristics and buffering of streams.
 	 */
 	struct StreamOptions
 	{
@@ -49,6 +50,23 @@ namespace BitSerializer
 		 * @brief Specifies the UTF encoding used for the output stream (only applies to text-based formats).
 		 */
 		Convert::Utf::UtfType encoding = Convert::Utf::UtfType::Utf8;
+
+		/**
+		 * @brief Size of the staging buffer used when writing to the output stream (only applies to binary formats).
+		 * The data is written to the stream in blocks of this size, 0 means writing each value directly.
+		 */
+		size_t writeBufferSize = 64 * 1024;
+
+		/**
+		 * @brief Size of the read-ahead buffer used when loading from the input stream (only applies to binary formats).
+		 * Values which fit into the buffer are read without extra copying.
+		 */
+		size_t readBufferSize = 8 * 1024;
+
+		/**
+		 * @brief Allows growing the read-ahead buffer to fit large values (instead of assembling them in the temporary buffer).
+		 */
+		bool growReadBuffer = false;
 	};
 
 	/**
@@ -147,5 +165,20 @@ namespace BitSerializer
 		 * Supported separators: ',', ';', '\t', ' ', '|'
 		 */
 		char valuesSeparator = ',';
+
+		/**
+		 * @brief Saves contiguous arrays of numbers (like `std::vector<float>`) as typed arrays (applies to MsgPack).
+		 *
+		 * Typed array is an extension type, which contains all items as a single block in little-endian byte order.
+		 * It is more compact and much faster to save/load, but other MsgPack libraries will see it as an unknown extension.
+		 */
+		bool useTypedArrays = false;
+
+		/**
+		 * @brief Measures the exact size of data before saving to the string and reserves it at once (applies to MsgPack).
+		 *
+		 * Avoids reallocations of the output string (and doubling of the peak memory) at the cost of an extra pass over the object.
+		 */
+		bool reserveExactSize = false;
 	};
 }
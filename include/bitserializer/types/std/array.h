@@ -14,6 +14,6 @@ namespace BitSerializer
 	template<typename TArchive, typename TValue, size_t ArraySize>
 	void SerializeArray(TArchive& archive, std::array<TValue, ArraySize>& cont)
 	{
-		Detail::SerializeFixedSizeArray(archive, std::begin(cont), std::end(cont));
+		Detail::SerializeFixedSizeArray(archive, cont.data(), cont.data() + cont.size());
 	}
 }
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include "binary_segments_reader.h"
+#include <limits>
+
+namespace BitSerializer::Detail
+{
+	CBinarySegmentsReader::CBinarySegmentsReader(const SegmentedInput& input) noexcept
+		: mSegments(input.begin())
+		, mSegmentsCount(input.size())
+		, mTotalSize(input.total_size())
+	{
+		SkipPassedSegments();
+	}
+
+	size_t CBinarySegmentsReader::GetMaxBlockSize() noexcept
+	{
+		return (std::numeric_limits<size_t>::max)();
+	}
+
+	bool CBinarySegmentsReader::SetPosition(size_t pos) noexcept
+	{
+		if (pos > mTotalSize)
+		{
+			mFailed = true;
+			return false;
+		}
+
+		// Seek back to the segment which contains the position
+		while (pos < mSegmentStart)
+		{
+			--mSegmentIndex;
+			mSegmentStart -= mSegments[mSegmentIndex].size();
+		}
+		mSegmentPos = pos - mSegmentStart;
+		SkipPassedSegments();
+		return true;
+	}
+
+	std::optional<char> CBinarySegmentsReader::PeekByte() const noexcept
+	{
+		if (mSegmentIndex != mSegmentsCount) {
+			return std::make_optional<char>(mSegments[mSegmentIndex][mSegmentPos]);
+		}
+		return std::nullopt;
+	}
+
+	void CBinarySegmentsReader::GotoNextByte() noexcept
+	{
+		if (mSegmentIndex != mSegmentsCount)
+		{
+			++mSegmentPos;
+			SkipPassedSegments();
+		}
+	}
+
+	std::optional<char> CBinarySegmentsReader::ReadByte() noexcept
+	{
+		if (mSegmentIndex != mSegmentsCount)
+		{
+			const auto result = std::make_optional<char>(mSegments[mSegmentIndex][mSegmentPos++]);
+			SkipPassedSegments();
+			return result;
+		}
+		return std::nullopt;
+	}
+
+	std::string_view CBinarySegmentsReader::ReadExactly(size_t blockSize)
+	{
+		if (blockSize == 0 || blockSize > mTotalSize - GetPosition()) {
+			return {};
+		}
+
+		// Return the block directly from the segment when it fits
+		const std::string_view segment = mSegments[mSegmentIndex];
+		if (blockSize <= segment.size() - mSegmentPos)
+		{
+			const std::string_view block = segment.substr(mSegmentPos, blockSize);
+			mSegmentPos += blockSize;
+			SkipPassedSegments();
+			return block;
+		}
+
+		// The block straddles the boundary of segments, it is assembled into the internal buffer
+		mBuffer.clear();
+		mBuffer.reserve(blockSize);
+		while (mBuffer.size() != blockSize) {
+			mBuffer.append(ReadUpTo(blockSize - mBuffer.size()));
+		}
+		return mBuffer;
+	}
+
+	std::string_view CBinarySegmentsReader::ReadUpTo(size_t maxBytesToRead) noexcept
+	{
+		if (mSegmentIndex != mSegmentsCount)
+		{
+			const std::string_view block = mSegments[mSegmentIndex].substr(mSegmentPos, maxBytesToRead);
+			mSegmentPos += block.size();
+			SkipPassedSegments();
+			return block;
+		}
+		return {};
+	}
+
+	void CBinarySegmentsReader::SkipPassedSegments() noexcept
+	{
+		while (mSegmentIndex != mSegmentsCount && mSegmentPos >= mSegments[mSegmentIndex].size())
+		{
+			const size_t segmentSize = mSegments[mSegmentIndex].size();
+			mSegmentPos -= segmentSize;
+			mSegmentStart += segmentSize;
+			++mSegmentIndex;
+		}
+	}
+}
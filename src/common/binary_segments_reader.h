@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <optional>
+#include <string>
+#include <string_view>
+#include "bitserializer/common/segmented_input.h"
+
+namespace BitSerializer::Detail
+{
+	/**
+	 * @brief A helper class for reading binary data from the sequence of segments (see `SegmentedInput`).
+	 *
+	 * Has the same interface as `CBinaryStreamReader`, but blocks which fit into one segment are returned without copying.
+	 * Only the blocks which straddle the boundary of segments are assembled into the internal buffer.
+	 */
+	class CBinarySegmentsReader
+	{
+	public:
+		explicit CBinarySegmentsReader(const SegmentedInput& input) noexcept;
+
+		// Disable copy and move operations
+		CBinarySegmentsReader(const CBinarySegmentsReader&) = delete;
+		CBinarySegmentsReader(CBinarySegmentsReader&&) = delete;
+		CBinarySegmentsReader& operator=(const CBinarySegmentsReader&) = delete;
+		CBinarySegmentsReader& operator=(CBinarySegmentsReader&&) = delete;
+		~CBinarySegmentsReader() = default;
+
+		/**
+		 * @brief Returns the maximum size of block which can be read via `ReadExactly()` (not limited).
+		 */
+		[[nodiscard]] static size_t GetMaxBlockSize() noexcept;
+
+		/**
+		 * @brief Checks if the end of the last segment has been reached.
+		 */
+		[[nodiscard]] bool IsEnd() const noexcept { return mSegmentIndex == mSegmentsCount; }
+
+		/**
+		 * @brief Checks if an error occurred during reading (attempt to set position beyond the end of data).
+		 */
+		[[nodiscard]] bool IsFailed() const noexcept { return mFailed; }
+
+		/**
+		 * @brief Gets the current position (in bytes from the beginning of the first segment).
+		 */
+		[[nodiscard]] size_t GetPosition() const noexcept { return mSegmentStart + mSegmentPos; }
+
+		/**
+		 * @brief Moves to the specified position (in bytes from the beginning of the first segment).
+		 * @return true on success, false if the position is beyond the end of data.
+		 */
+		bool SetPosition(size_t pos) noexcept;
+
+		/**
+		 * @brief Peeks at the next byte without incrementing the current position.
+		 */
+		[[nodiscard]] std::optional<char> PeekByte() const noexcept;
+
+		/**
+		 * @brief Increments the current position by one byte.
+		 */
+		void GotoNextByte() noexcept;
+
+		/**
+		 * @brief Reads the next byte and increments the current position.
+		 */
+		[[nodiscard]] std::optional<char> ReadByte() noexcept;
+
+		/**
+		 * @brief Reads exactly specified number of bytes as a contiguous block.
+		 *
+		 * @return A `string_view` referencing the data in the segment or in the internal buffer (when the block straddles
+		 *         the boundary of segments), or an empty view if the requested number of bytes is not available.
+		 *         The view to the internal buffer is valid until the next read operation.
+		 */
+		[[nodiscard]] std::string_view ReadExactly(size_t blockSize);
+
+		/**
+		 * @brief Reads the block up to the end of current segment, if the returned block is smaller than the requested one,
+		 * you need to call the method again.
+		 */
+		[[nodiscard]] std::string_view ReadUpTo(size_t maxBytesToRead) noexcept;
+
+	private:
+		/**
+		 * @brief Moves to the segment which contains the current position (skips passed and empty segments).
+		 */
+		void SkipPassedSegments() noexcept;
+
+		const std::string_view* mSegments;
+		const size_t mSegmentsCount;
+		const size_t mTotalSize;
+		size_t mSegmentIndex = 0;
+		size_t mSegmentStart = 0;
+		size_t mSegmentPos = 0;
+		bool mFailed = false;
+		std::string mBuffer;
+	};
+
+} // namespace BitSerializer::Detail
@@ -3,18 +3,31 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #include "binary_stream_reader.h"
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <istream>
+#include <limits>
 
 namespace BitSerializer::Detail
 {
-	CBinaryStreamReader::CBinaryStreamReader(std::istream& inputStream)
+	CBinaryStreamReader::CBinaryStreamReader(std::istream& inputStream, size_t chunkSize, bool allowGrow)
 		: mStream(inputStream)
+		, mBufferSize((std::max)(chunkSize, min_chunk_size))
+		, mBuffer(new char[mBufferSize])
+		, mEndBufferPtr(mBuffer.get() + mBufferSize)
+		, mStartDataPtr(mBuffer.get())
+		, mEndDataPtr(mBuffer.get())
+		, mAllowGrow(allowGrow)
 	{
 		ReadNextChunk();
 	}
 
+	size_t CBinaryStreamReader::GetMaxBlockSize() const noexcept
+	{
+		return mAllowGrow ? (std::numeric_limits<size_t>::max)() : mBufferSize;
+	}
+
 	bool CBinaryStreamReader::IsEnd() const noexcept
 	{
 		return mStartDataPtr == mEndDataPtr && mStream.eof();
@@ -32,23 +45,30 @@ namespace BitSerializer::Detail
 
 	bool CBinaryStreamReader::SetPosition(size_t pos)
 	{
-		const std::streamsize cachedSize = mEndDataPtr - mBuffer;
+		const std::streamsize cachedSize = mEndDataPtr - mBuffer.get();
 		if (pos >= mStreamPos - cachedSize && pos < mStreamPos)
 		{
 			const auto chunkOffset = pos - (mStreamPos - cachedSize);
-			mStartDataPtr = mBuffer + chunkOffset;
+			mStartDataPtr = mBuffer.get() + chunkOffset;
 			return true;
 		}
 
+		// Reading of the last chunk sets `eofbit` and `failbit`, they need to be cleared for seeking back
+		const auto prevState = mStream.rdstate();
+		if (pos != mStreamPos && mStream.eof()) {
+			mStream.clear();
+		}
+
 		if (pos == mStreamPos || !mStream.seekg(static_cast<std::streamoff>(pos)).fail())
 		{
 			mStreamPos = pos;
 			// Invalidate cache
-			mStartDataPtr = mEndDataPtr = mBuffer;
+			mStartDataPtr = mEndDataPtr = mBuffer.get();
 			ReadNextChunk();
 			return true;
 		}
 
+		mStream.setstate(prevState);
 		return false;
 	}
 
@@ -85,15 +105,22 @@ namespace BitSerializer::Detail
 
 	std::string_view CBinaryStreamReader::ReadExactly(size_t blockSize)
 	{
-		assert(blockSize <= chunk_size);
-		if (blockSize > chunk_size) {
-			return {};
+		if (blockSize > mBufferSize)
+		{
+			assert(mAllowGrow);
+			if (!mAllowGrow) {
+				return {};
+			}
 		}
 
-		if (mStartDataPtr + blockSize > mEndDataPtr)
+		while (static_cast<size_t>(mEndDataPtr - mStartDataPtr) < blockSize)
 		{
-			if (!ReadNextChunk() || mStartDataPtr + blockSize > mEndDataPtr)
-			{
+			// The size of block is declared in the input data, so the buffer is doubled only when it is already
+			// filled by received data (a corrupted size can't force allocating much more than the size of stream)
+			if (blockSize > mBufferSize && mStartDataPtr == mBuffer.get() && mEndDataPtr == mEndBufferPtr) {
+				GrowBuffer((std::min)(blockSize, mBufferSize * 2));
+			}
+			if (!ReadNextChunk()) {
 				return {};
 			}
 		}
@@ -134,14 +161,14 @@ namespace BitSerializer::Detail
 
 		if (mStartDataPtr == mEndBufferPtr)
 		{
-			mStartDataPtr = mEndDataPtr = mBuffer;
+			mStartDataPtr = mEndDataPtr = mBuffer.get();
 		}
-		else if (mStartDataPtr != mBuffer)
+		else if (mStartDataPtr != mBuffer.get())
 		{
 			// Squeeze buffer
-			std::memcpy(mBuffer, mStartDataPtr, mEndDataPtr - mStartDataPtr);
-			mEndDataPtr -= mStartDataPtr - mBuffer;
-			mStartDataPtr = mBuffer;
+			std::memmove(mBuffer.get(), mStartDataPtr, mEndDataPtr - mStartDataPtr);
+			mEndDataPtr -= mStartDataPtr - mBuffer.get();
+			mStartDataPtr = mBuffer.get();
 		}
 
 		// Read next chunk
@@ -149,7 +176,20 @@ namespace BitSerializer::Detail
 		const auto lastReadSize = static_cast<size_t>(mStream.gcount());
 		mEndDataPtr += lastReadSize;
 		mStreamPos += lastReadSize;
-		assert(mStartDataPtr >= mBuffer && mStartDataPtr <= mEndDataPtr);
+		assert(mStartDataPtr >= mBuffer.get() && mStartDataPtr <= mEndDataPtr);
 		return lastReadSize != 0;
 	}
+
+	void CBinaryStreamReader::GrowBuffer(size_t newSize)
+	{
+		std::unique_ptr<char[]> newBuffer(new char[newSize]);
+		const auto cachedSize = mEndDataPtr - mBuffer.get();
+		std::memcpy(newBuffer.get(), mBuffer.get(), cachedSize);
+
+		mStartDataPtr = newBuffer.get() + (mStartDataPtr - mBuffer.get());
+		mEndDataPtr = newBuffer.get() + cachedSize;
+		mBuffer = std::move(newBuffer);
+		mBufferSize = newSize;
+		mEndBufferPtr = mBuffer.get() + mBufferSize;
+	}
 }
@@ -4,6 +4,7 @@
 *******************************************************************************/
 #pragma once
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string_view>
 
@@ -18,15 +19,19 @@ namespace BitSerializer::Detail
 	class CBinaryStreamReader
 	{
 	public:
-		/// @brief Size of the internal read buffer in bytes.
-		static constexpr size_t chunk_size = 256u;
+		/// @brief Default size of the internal read buffer in bytes (blocks up to this size can be read without copying).
+		static constexpr size_t default_chunk_size = 8192u;
+		/// @brief Minimal size of the internal read buffer (enough for reading any fixed-size value).
+		static constexpr size_t min_chunk_size = 64u;
 
 		/**
 		 * @brief Constructs a new binary stream reader for the specified input stream.
 		 *
 		 * @param inputStream Reference to the input stream to read from.
+		 * @param chunkSize   Size of the internal read buffer (can't be less than `min_chunk_size`).
+		 * @param allowGrow   Allows growing the buffer when requested block is larger than its size (see `ReadExactly()`).
 		 */
-		explicit CBinaryStreamReader(std::istream& inputStream);
+		explicit CBinaryStreamReader(std::istream& inputStream, size_t chunkSize = default_chunk_size, bool allowGrow = false);
 
 		// Disable copy and move operations
 		CBinaryStreamReader(const CBinaryStreamReader&) = delete;
@@ -35,6 +40,16 @@ namespace BitSerializer::Detail
 		CBinaryStreamReader& operator=(CBinaryStreamReader&&) = delete;
 		~CBinaryStreamReader() = default;
 
+		/**
+		 * @brief Returns the current size of the internal read buffer.
+		 */
+		[[nodiscard]] size_t GetChunkSize() const noexcept { return mBufferSize; }
+
+		/**
+		 * @brief Returns the maximum size of block which can be read via `ReadExactly()`.
+		 */
+		[[nodiscard]] size_t GetMaxBlockSize() const noexcept;
+
 		/**
 		 * @brief Checks if the end of the stream has been reached.
 		 *
@@ -85,8 +100,11 @@ namespace BitSerializer::Detail
 		/**
 		 * @brief Attempts to read exactly specified number of bytes as a contiguous block.
 		 *
-		 * @param blockSize The number of bytes to read. Must not exceed the internal buffer size (e.g., `chunk_size`).
+		 * When growing is allowed, the buffer grows in bounded steps (doubles) while the data of block is received from the stream.
+		 *
+		 * @param blockSize The number of bytes to read. Must not exceed the internal buffer size, unless growing is allowed.
 		 * @return A `string_view` referencing the read data, or an empty view if the requested number of bytes is not available.
+		 *         The view references the internal buffer and is valid until the next read operation.
 		 */
 		[[nodiscard]] std::string_view ReadExactly(size_t blockSize);
 
@@ -106,12 +124,19 @@ namespace BitSerializer::Detail
 		 */
 		bool ReadNextChunk();
 
+		/**
+		 * @brief Grows the internal buffer to the specified size (cached data is preserved).
+		 */
+		void GrowBuffer(size_t newSize);
+
 		std::istream& mStream;
-		char mBuffer[chunk_size];
-		const char* const mEndBufferPtr = mBuffer + chunk_size;
-		char* mStartDataPtr = mBuffer;
-		char* mEndDataPtr = mBuffer;
+		size_t mBufferSize;
+		std::unique_ptr<char[]> mBuffer;
+		const char* mEndBufferPtr;
+		char* mStartDataPtr;
+		char* mEndDataPtr;
 		size_t mStreamPos = 0;
+		const bool mAllowGrow;
 	};
 
 } // namespace BitSerializer::Detail
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include "bitserializer/common/mapped_file.h"
+
+#if BITSERIALIZER_HAS_MAPPED_FILES
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BitSerializer::Detail
+{
+	bool CMappedFile::Open([[maybe_unused]] const char* path) noexcept
+	{
+		Close();
+#if BITSERIALIZER_HAS_MAPPED_FILES
+		const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+		if (fd == -1) {
+			return false;
+		}
+
+		struct stat fileStat {};
+		if (::fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
+		{
+			const auto fileSize = static_cast<size_t>(fileStat.st_size);
+			if (void* data = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0); data != MAP_FAILED)
+			{
+				::madvise(data, fileSize, MADV_SEQUENTIAL);
+				mData = static_cast<const char*>(data);
+				mSize = fileSize;
+			}
+		}
+		// The mapping remains valid after closing the file descriptor
+		::close(fd);
+#endif
+		return IsOpen();
+	}
+
+	void CMappedFile::Close() noexcept
+	{
+#if BITSERIALIZER_HAS_MAPPED_FILES
+		if (mData != nullptr) {
+			::munmap(const_cast<char*>(mData), mSize);
+		}
+#endif
+		mData = nullptr;
+		mSize = 0;
+	}
+}
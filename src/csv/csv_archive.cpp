@@ -42,6 +42,22 @@ namespace BitSerializer::Csv::Detail
 		mCsvWriter = std::make_unique<CCsvStreamWriter>(outputStream, true, serializationContext.GetOptions().valuesSeparator, serializationContext.GetOptions().utfEncodingErrorPolicy, serializationContext.GetOptions().streamOptions).release();
 	}
 
+	CsvWriteRootScope::CsvWriteRootScope(FixedOutputBuffer& outputBuffer, SerializationContext& serializationContext)
+		: TArchiveScope<SerializeMode::Save>(serializationContext)
+	{
+		ValidateSeparator(serializationContext.GetOptions().valuesSeparator);
+		// Use `make_unique` to free memory gracefully when an exception occurs in the constructor
+		mCsvWriter = std::make_unique<CCsvBufferWriter>(outputBuffer, true, serializationContext.GetOptions().valuesSeparator).release();
+	}
+
+	CsvWriteRootScope::CsvWriteRootScope(BitSerializer::Detail::COutputStringRef outputString, SerializationContext& serializationContext)
+		: TArchiveScope<SerializeMode::Save>(serializationContext)
+	{
+		ValidateSeparator(serializationContext.GetOptions().valuesSeparator);
+		// Use `make_unique` to free memory gracefully when an exception occurs in the constructor
+		mCsvWriter = std::make_unique<CCsvStringRefWriter>(std::move(outputString), true, serializationContext.GetOptions().valuesSeparator).release();
+	}
+
 	CsvWriteRootScope::~CsvWriteRootScope()
 	{
 		delete mCsvWriter;
@@ -7,6 +7,40 @@
 
 namespace BitSerializer::Csv::Detail
 {
+	size_t CCsvHeadersIndex::FindColumn(std::string_view key, size_t nextColumn)
+	{
+		size_t column = npos;
+		// The column that was found for this field in the previous row
+		if (mFieldIndex < mColumnsPlan.size())
+		{
+			const size_t plannedColumn = mColumnsPlan[mFieldIndex];
+			if (plannedColumn < mHeaders.size() && mHeaders[plannedColumn] == key) {
+				column = plannedColumn;
+			}
+		}
+
+		if (column == npos)
+		{
+			if (nextColumn < mHeaders.size() && mHeaders[nextColumn] == key) {
+				column = nextColumn;
+			}
+			else if (const auto it = mColumns.find(key); it != mColumns.end()) {
+				column = it->second;
+			}
+
+			if (mFieldIndex < mColumnsPlan.size()) {
+				mColumnsPlan[mFieldIndex] = column;
+			}
+			else {
+				mColumnsPlan.push_back(column);
+			}
+		}
+		++mFieldIndex;
+		return column;
+	}
+
+	//------------------------------------------------------------------------------
+
 	CCsvStringReader::CCsvStringReader(std::string_view inputString, bool withHeader, char separator)
 		: mSourceString(inputString)
 		, mWithHeader(withHeader)
@@ -21,8 +55,18 @@ namespace BitSerializer::Csv::Detail
 				{
 					ReadValue(header);
 				}
-				// Lock the part of the buffer used to store decoded headers
-				mLockedBufferSize = mTempValueBuffer.size();
+				// Move decoded headers out of the temporary buffer (it can be reallocated when parsing next lines)
+				if (!mTempValueBuffer.empty())
+				{
+					mDecodedHeaders.assign(mTempValueBuffer.data(), mTempValueBuffer.size());
+					for (size_t i = 0; i < mHeaders.size(); ++i)
+					{
+						if (const auto& valueMeta = mRowValuesMeta[i]; !valueMeta.InOriginalData) {
+							mHeaders[i] = std::string_view(mDecodedHeaders.data() + valueMeta.Offset, valueMeta.Size);
+						}
+					}
+				}
+				mHeadersIndex.Build(mHeaders);
 			}
 			else
 			{
@@ -51,22 +95,13 @@ namespace BitSerializer::Csv::Detail
 			return false;
 		}
 
-		if (mValueIndex >= mHeaders.size() || mHeaders[mValueIndex] != key)
+		const size_t column = mHeadersIndex.FindColumn(key, mValueIndex);
+		if (column == CCsvHeadersIndex::npos)
 		{
-			// If next column doesn't match, try to find across all headers
-			for (mValueIndex = 0; mValueIndex < mHeaders.size(); ++mValueIndex)
-			{
-				if (mHeaders[mValueIndex] == key)
-				{
-					break;
-				}
-			}
-			if (mValueIndex == mHeaders.size())
-			{
-				out_value = {};
-				return false;
-			}
+			out_value = {};
+			return false;
 		}
+		mValueIndex = column;
 
 		const auto& valueMeta = mRowValuesMeta[mValueIndex];
 		out_value = std::string_view((valueMeta.InOriginalData ? mSourceString.data() : mTempValueBuffer.data()) + valueMeta.Offset, valueMeta.Size);
@@ -105,6 +140,7 @@ namespace BitSerializer::Csv::Detail
 			}
 
 			mValueIndex = 0;
+			mHeadersIndex.NextRow();
 			// Header is not counted as data row
 			const bool firstDataRow = mLineNumber == (mWithHeader ? 2u : 1u);
 			if (!firstDataRow)
@@ -125,7 +161,7 @@ namespace BitSerializer::Csv::Detail
 		}
 
 		++mLineNumber;
-		mTempValueBuffer.resize(mLockedBufferSize);
+		mTempValueBuffer.clear();
 		mPrevValuesCount = mRowValuesMeta.size();
 		mRowValuesMeta.clear();
 
@@ -267,6 +303,7 @@ namespace BitSerializer::Csv::Detail
 					ReadValue(val);
 					header = val;
 				}
+				mHeadersIndex.Build(mHeaders);
 			}
 			else
 			{
@@ -295,22 +332,13 @@ namespace BitSerializer::Csv::Detail
 			return false;
 		}
 
-		if (mValueIndex >= mHeaders.size() || mHeaders[mValueIndex] != key)
+		const size_t column = mHeadersIndex.FindColumn(key, mValueIndex);
+		if (column == CCsvHeadersIndex::npos)
 		{
-			// If next column doesn't match, try to find across all headers
-			for (mValueIndex = 0; mValueIndex < mHeaders.size(); ++mValueIndex)
-			{
-				if (mHeaders[mValueIndex] == key)
-				{
-					break;
-				}
-			}
-			if (mValueIndex == mHeaders.size())
-			{
-				out_value = {};
-				return false;
-			}
+			out_value = {};
+			return false;
 		}
+		mValueIndex = column;
 
 		const auto& valueMeta = mRowValuesMeta[mValueIndex];
 		out_value = std::string_view(mDecodedBuffer.data() + valueMeta.Offset, valueMeta.Size);
@@ -350,6 +378,7 @@ namespace BitSerializer::Csv::Detail
 			}
 
 			mValueIndex = 0;
+			mHeadersIndex.NextRow();
 			// Header is not counted as data row
 			const bool firstDataRow = mLineNumber == (mWithHeader ? 2u : 1u);
 			if (!firstDataRow)
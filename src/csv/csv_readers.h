@@ -3,11 +3,57 @@
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
 #pragma once
+#include <unordered_map>
 #include <vector>
 #include "bitserializer/csv_archive.h"
 
 namespace BitSerializer::Csv::Detail
 {
+	/**
+	 * @brief Index for finding columns by the names of headers.
+	 *
+	 * Besides the hash map of headers, keeps the plan of columns in order of reading fields, as fields of the model
+	 * are read in the same order in each row, from the second row they are resolved without searching.
+	 */
+	class CCsvHeadersIndex
+	{
+	public:
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		/**
+		 * @brief Builds the index (passed headers must not be changed while the index is used).
+		 */
+		template <typename TString>
+		void Build(const std::vector<TString>& headers)
+		{
+			mHeaders.assign(headers.cbegin(), headers.cend());
+			mColumns.reserve(mHeaders.size());
+			for (size_t i = 0; i < mHeaders.size(); ++i)
+			{
+				// The first column is used when headers are duplicated
+				mColumns.emplace(mHeaders[i], i);
+			}
+		}
+
+		/**
+		 * @brief Finds the column of the field (the next column is checked before searching in the index).
+		 *
+		 * @return The index of column or `npos` when the header with such name does not exist.
+		 */
+		[[nodiscard]] size_t FindColumn(std::string_view key, size_t nextColumn);
+
+		/**
+		 * @brief Starts reading fields of the next row.
+		 */
+		void NextRow() noexcept { mFieldIndex = 0; }
+
+	private:
+		std::vector<std::string_view> mHeaders;
+		std::unordered_map<std::string_view, size_t> mColumns;
+		std::vector<size_t> mColumnsPlan;
+		size_t mFieldIndex = 0;
+	};
+
 	class CCsvStringReader final : public ICsvReader
 	{
 		struct CValueMeta
@@ -46,9 +92,10 @@ namespace BitSerializer::Csv::Detail
 		const char mSeparator;
 
 		std::vector<std::string_view> mHeaders;
+		std::string mDecodedHeaders;
+		CCsvHeadersIndex mHeadersIndex;
 		std::vector<CValueMeta> mRowValuesMeta;
 		std::vector<std::string::value_type> mTempValueBuffer;
-		size_t mLockedBufferSize = 0;
 		size_t mCurrentPos = 0;
 		size_t mLineNumber = 0;
 		size_t mRowIndex = 0;
@@ -93,6 +140,7 @@ namespace BitSerializer::Csv::Detail
 		const char mSeparator;
 
 		std::vector<std::string> mHeaders;
+		CCsvHeadersIndex mHeadersIndex;
 		std::vector<CValueMeta> mRowValuesMeta;
 		size_t mCurrentPos = 0;
 		size_t mLineNumber = 0;
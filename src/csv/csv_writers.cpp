@@ -2,6 +2,7 @@
 * Copyright (C) 2018-2025 by Pavel Kisliak                                     *
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
+#include <algorithm>
 #include "csv_writers.h"
 
 
@@ -9,7 +10,8 @@ namespace
 {
 	using namespace BitSerializer;
 
-	void WriteEscapedValue(const std::string_view& value, std::string& outputString, const char separator)
+	template <typename TOutput>
+	void WriteEscapedValue(const std::string_view& value, TOutput& outputString, const char separator)
 	{
 		const char* it = value.data();
 		const char* endIt = it + value.size();
@@ -31,7 +33,7 @@ namespace
 		{
 			// RFC: Fields containing line breaks (CRLF), double quotes, and commas should be enclosed in double-quotes
 			outputString.push_back('"');
-			outputString.append(value.data(), it);	// NOLINT(bugprone-suspicious-stringview-data-usage)
+			outputString.append(value.data(), static_cast<size_t>(it - value.data()));
 
 			for (; it != endIt; ++it)
 			{
@@ -50,8 +52,9 @@ namespace
 
 namespace BitSerializer::Csv::Detail
 {
-	CCsvStringWriter::CCsvStringWriter(std::string& outputString, bool withHeader, char separator)
-		: mOutputString(outputString)
+	template <typename TOutput>
+	CCsvBasicStringWriter<TOutput>::CCsvBasicStringWriter(output_ref_type outputString, bool withHeader, char separator)
+		: mOutputString(std::forward<output_ref_type>(outputString))
 		, mWithHeader(withHeader)
 		, mSeparator(separator)
 	{
@@ -59,12 +62,14 @@ namespace BitSerializer::Csv::Detail
 		mOutputString.reserve(256);
 	}
 
-	void CCsvStringWriter::SetEstimatedSize(size_t size)
+	template <typename TOutput>
+	void CCsvBasicStringWriter<TOutput>::SetEstimatedSize(size_t size)
 	{
 		mEstimatedSize = size;
 	}
 
-	void CCsvStringWriter::WriteValue(const std::string_view& key, std::string_view value)
+	template <typename TOutput>
+	void CCsvBasicStringWriter<TOutput>::WriteValue(const std::string_view& key, std::string_view value)
 	{
 		// Write keys only when it's first row
 		if (mRowIndex == 0 && mWithHeader)
@@ -84,7 +89,8 @@ namespace BitSerializer::Csv::Detail
 		++mValueIndex;
 	}
 
-	void CCsvStringWriter::NextLine()
+	template <typename TOutput>
+	void CCsvBasicStringWriter<TOutput>::NextLine()
 	{
 		if (mRowIndex == 0)
 		{
@@ -123,6 +129,78 @@ namespace BitSerializer::Csv::Detail
 		mCurrentRow.clear();
 	}
 
+	template class CCsvBasicStringWriter<std::string>;
+	template class CCsvBasicStringWriter<BitSerializer::Detail::COutputStringRef>;
+
+	//------------------------------------------------------------------------------
+
+	CCsvBufferWriter::CCsvBufferWriter(FixedOutputBuffer& outputBuffer, bool withHeader, char separator)
+		: mOutputBuffer(outputBuffer)
+		, mWithHeader(withHeader)
+		, mSeparator(separator)
+	{ }
+
+	void CCsvBufferWriter::WriteValue(const std::string_view& key, std::string_view value)
+	{
+		// Write keys only when it's first row
+		if (mRowIndex == 0 && mWithHeader)
+		{
+			const size_t keyPos = mOutputBuffer.size();
+			if (mValueIndex)
+			{
+				mOutputBuffer.push_back(mSeparator);
+			}
+			WriteEscapedValue(key, mOutputBuffer, mSeparator);
+			MoveToHeader(keyPos);
+		}
+
+		if (mValueIndex)
+		{
+			mOutputBuffer.push_back(mSeparator);
+		}
+		WriteEscapedValue(value, mOutputBuffer, mSeparator);
+		++mValueIndex;
+	}
+
+	void CCsvBufferWriter::NextLine()
+	{
+		if (mRowIndex == 0)
+		{
+			if (mWithHeader)
+			{
+				const size_t endOfHeaderPos = mOutputBuffer.size();
+				mOutputBuffer.append("\r\n", 2);
+				MoveToHeader(endOfHeaderPos);
+			}
+			mPrevValuesCount = mValueIndex;
+		}
+		else
+		{
+			// Compare number of values with previous row
+			if (mValueIndex != mPrevValuesCount)
+			{
+				throw SerializationException(SerializationErrorCode::OutOfRange,
+					"Number of values are different than in previous line");
+			}
+		}
+
+		mOutputBuffer.append("\r\n", 2);
+
+		++mRowIndex;
+		mValueIndex = 0;
+	}
+
+	void CCsvBufferWriter::MoveToHeader(size_t pos) noexcept
+	{
+		// The first row is written right after the header, so the part of header that was appended is moved before it
+		if (!mOutputBuffer.overflowed())
+		{
+			char* data = mOutputBuffer.data();
+			std::rotate(data + mHeaderSize, data + pos, data + mOutputBuffer.size());
+		}
+		mHeaderSize += mOutputBuffer.size() - pos;
+	}
+
 	//------------------------------------------------------------------------------
 
 	CCsvStreamWriter::CCsvStreamWriter(std::ostream& outputStream, bool withHeader, char separator,
@@ -7,10 +7,19 @@
 
 namespace BitSerializer::Csv::Detail
 {
-	class CCsvStringWriter final : public ICsvWriter
+	/**
+	 * @brief CSV writer to `std::string` or to strings with custom allocators (via `COutputStringRef`).
+	 *
+	 * @tparam TOutput The output type with interface of `std::string`.
+	 */
+	template <typename TOutput>
+	class CCsvBasicStringWriter final : public ICsvWriter
 	{
 	public:
-		CCsvStringWriter(std::string& outputString, bool withHeader, char separator = ',');
+		/// The reference to output (`COutputStringRef` is already a reference, so it is stored by value).
+		using output_ref_type = std::conditional_t<std::is_same_v<TOutput, BitSerializer::Detail::COutputStringRef>, TOutput, TOutput&>;
+
+		CCsvBasicStringWriter(output_ref_type outputString, bool withHeader, char separator = ',');
 
 		void SetEstimatedSize(size_t size) override;
 		void WriteValue(const std::string_view& key, std::string_view value) override;
@@ -18,7 +27,7 @@ namespace BitSerializer::Csv::Detail
 		[[nodiscard]] size_t GetCurrentIndex() const noexcept override { return mRowIndex; }
 
 	private:
-		std::string& mOutputString;
+		output_ref_type mOutputString;
 		const bool mWithHeader;
 		const char mSeparator;
 
@@ -29,6 +38,38 @@ namespace BitSerializer::Csv::Detail
 		size_t mPrevValuesCount = 0;
 	};
 
+	using CCsvStringWriter = CCsvBasicStringWriter<std::string>;
+	using CCsvStringRefWriter = CCsvBasicStringWriter<BitSerializer::Detail::COutputStringRef>;
+
+	/**
+	 * @brief CSV writer to the fixed buffer provided by caller (rows are written directly, without staging buffer).
+	 */
+	class CCsvBufferWriter final : public ICsvWriter
+	{
+	public:
+		CCsvBufferWriter(FixedOutputBuffer& outputBuffer, bool withHeader, char separator = ',');
+
+		void SetEstimatedSize(size_t) noexcept override { /* Not required for fixed buffer */ }
+		void WriteValue(const std::string_view& key, std::string_view value) override;
+		void NextLine() override;
+		[[nodiscard]] size_t GetCurrentIndex() const noexcept override { return mRowIndex; }
+
+	private:
+		/**
+		 * @brief Moves the data from `pos` to the end of output, to the end of header (before the values of first row).
+		 */
+		void MoveToHeader(size_t pos) noexcept;
+
+		FixedOutputBuffer& mOutputBuffer;
+		const bool mWithHeader;
+		const char mSeparator;
+
+		size_t mHeaderSize = 0;
+		size_t mRowIndex = 0;
+		size_t mValueIndex = 0;
+		size_t mPrevValuesCount = 0;
+	};
+
 	class CCsvStreamWriter final : public ICsvWriter
 	{
 	public:
@@ -2,8 +2,12 @@
 * Copyright (C) 2018-2025 by Pavel Kisliak                                     *
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
-#include "msgpack_readers.h"
+#include <algorithm>
+#include <cstring>
+#include "bitserializer/msgpack_archive.h"
 #include "bitserializer/common/memory.h"
+#include "common/binary_segments_reader.h"
+#include "common/binary_stream_reader.h"
 
 /*
 -----------------------------------------------------------
@@ -52,6 +56,8 @@ namespace
 {
 	using namespace BitSerializer;
 	using ValueType = MsgPack::Detail::ValueType;
+	using MsgPack::Detail::TypedArrayItemType;
+	using MsgPack::Detail::GetTypedArrayItemSize;
 
 	struct ByteCodeMetaInfo
 	{
@@ -197,6 +203,56 @@ namespace
 		char ByteCode = 0;
 		char ExtTypeCode = 0;
 	};
+
+	/**
+	 * @brief Returns the number of items in the typed array (validates the type of items and size of data).
+	 */
+	size_t GetTypedArraySize(const ExtTypeInfo& extTypeInfo, char itemTypeCode, TypedArrayItemType& itemType, size_t pos)
+	{
+		itemType = static_cast<TypedArrayItemType>(itemTypeCode);
+		const size_t itemSize = GetTypedArrayItemSize(itemType);
+		if (itemSize == 0) {
+			throw ParsingException("Unknown type of items in typed array", 0, pos);
+		}
+		const size_t dataSize = extTypeInfo.Size - 1;
+		if (dataSize % itemSize != 0) {
+			throw ParsingException("Invalid size of typed array", 0, pos);
+		}
+		return dataSize / itemSize;
+	}
+
+	/**
+	 * @brief Loads the big-endian unsigned number of specified size (from 1 to 8 bytes).
+	 *
+	 * When at least 8 bytes are available, the number is loaded via one unaligned read and shifted to its size.
+	 */
+	inline uint64_t LoadBigEndian(const char* data, size_t size, size_t availableSize) noexcept
+	{
+		uint64_t buf = 0;
+		if (availableSize >= sizeof(uint64_t)) {
+			std::memcpy(&buf, data, sizeof(uint64_t));
+		}
+		else {
+			std::memcpy(&buf, data, size);
+		}
+		return Memory::BigEndianToNative(buf) >> (64 - size * 8);
+	}
+
+	/**
+	 * @brief Converts the loaded bits of integer (described by byte code metadata) to the target type.
+	 */
+	template <typename T>
+	bool ConvertInteger(const ByteCodeMetaInfo& byteCodeInfo, uint64_t bits, T& outValue, const SerializationOptions& serializationOptions)
+	{
+		if (byteCodeInfo.Type == ValueType::SignedInteger)
+		{
+			// Sign extension of the loaded number
+			const auto shift = 64 - byteCodeInfo.DataSize * 8;
+			const auto value = static_cast<int64_t>(bits << shift) >> shift;
+			return Detail::ConvertByPolicy(value, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
+		}
+		return Detail::ConvertByPolicy(bits, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
+	}
 }
 
 
@@ -222,7 +278,8 @@ namespace
 	{
 		if (pos + sizeof(T) <= inputData.size())
 		{
-			outValue = Memory::BigEndianToNative(*reinterpret_cast<const T*>(inputData.data() + pos));
+			std::memcpy(&outValue, inputData.data() + pos, sizeof(T));
+			outValue = Memory::BigEndianToNative(outValue);
 			pos += sizeof(T);
 		}
 		else {
@@ -253,56 +310,51 @@ namespace
 		throw std::invalid_argument("Internal error: invalid range of 'extSizeBytesNum'");
 	}
 
+	/**
+	 * @brief Skips the value including all nested arrays and maps (without recursion).
+	 *
+	 * Scalars and length-prefixed values (strings, binary arrays, extensions) are skipped in one step,
+	 * the items of arrays and maps are just added to the counter of pending values.
+	 */
 	void SkipValueImpl(std::string_view inputData, size_t& pos)
 	{
-		if (pos < inputData.size())
+		if (pos >= inputData.size()) {
+			throw ParsingException("No more values to read", 0, pos);
+		}
+
+		// The number of values which remain to skip (keys and values of maps are counted separately)
+		uint64_t pendingValues = 1;
+		do
 		{
+			if (pos >= inputData.size()) {
+				throw ParsingException("Unexpected end of input archive", 0, pos);
+			}
 			const auto& byteCodeInfo = ByteCodeTable[static_cast<uint_fast8_t>(inputData[pos++])];
+			--pendingValues;
 
 			size_t size = byteCodeInfo.DataSize;
-			uint32_t extSize = 0;
-			if (byteCodeInfo.FixedSeq)
-			{
-				extSize += byteCodeInfo.FixedSeq;
-			}
-			else if (byteCodeInfo.ExtSize)
+			uint32_t seqSize = byteCodeInfo.FixedSeq;
+			if (byteCodeInfo.ExtSize)
 			{
+				seqSize = ReadExtSize(byteCodeInfo.ExtSize, inputData, pos);
 				size += byteCodeInfo.ExtSize;
-				extSize = ReadExtSize(byteCodeInfo.ExtSize, inputData, pos);
 			}
 
-			if (byteCodeInfo.Type == ValueType::String || byteCodeInfo.Type == ValueType::BinaryArray || byteCodeInfo.Type == ValueType::Ext)
-			{
-				size += extSize;
-				extSize = 0;
+			if (byteCodeInfo.Type == ValueType::Array) {
+				pendingValues += seqSize;
+			}
+			else if (byteCodeInfo.Type == ValueType::Map) {
+				pendingValues += static_cast<uint64_t>(seqSize) * 2;
+			}
+			else if (byteCodeInfo.Type == ValueType::String || byteCodeInfo.Type == ValueType::BinaryArray || byteCodeInfo.Type == ValueType::Ext) {
+				size += seqSize;
 			}
 
-			if (pos + size <= inputData.size())
-			{
-				pos += size;
-				if (extSize)
-				{
-					if (byteCodeInfo.Type == ValueType::Map)
-					{
-						for (uint32_t i = 0; i < extSize; ++i)
-						{
-							SkipValueImpl(inputData, pos);
-							SkipValueImpl(inputData, pos);
-						}
-					}
-					else if (byteCodeInfo.Type == ValueType::Array)
-					{
-						for (uint32_t i = 0; i < extSize; ++i)
-						{
-							SkipValueImpl(inputData, pos);
-						}
-					}
-				}
-				return;
+			if (size > inputData.size() - pos) {
+				throw ParsingException("Unexpected end of input archive", 0, pos);
 			}
-			throw ParsingException("Unexpected end of input archive", 0, pos);
-		}
-		throw ParsingException("No more values to read", 0, pos);
+			pos += size;
+		} while (pendingValues != 0);
 	}
 
 	void HandleMismatchedTypesPolicy(std::string_view inputData, size_t& pos, ValueType actualType, MismatchedTypesPolicy mismatchedTypesPolicy)
@@ -322,79 +374,31 @@ namespace
 		if (pos < inputData.size())
 		{
 			const auto byteCode = static_cast<uint_fast8_t>(inputData[pos]);
+			// Fast path for fixed positive and negative integers
 			if (byteCode < 0x80 || byteCode >= 0xE0)
 			{
 				++pos;
 				return Detail::ConvertByPolicy(static_cast<int8_t>(byteCode), outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
 			}
-			if (byteCode == 0xCC)
-			{
-				++pos;
-				uint8_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xCD)
-			{
-				++pos;
-				uint16_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xCE)
-			{
-				++pos;
-				uint32_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xCF)
-			{
-				++pos;
-				uint64_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD0)
-			{
-				++pos;
-				int8_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD1)
-			{
-				++pos;
-				int16_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD2)
-			{
-				++pos;
-				int32_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD3)
+
+			const auto& byteCodeInfo = ByteCodeTable[byteCode];
+			if (byteCodeInfo.Type == ValueType::UnsignedInteger || byteCodeInfo.Type == ValueType::SignedInteger)
 			{
-				++pos;
-				int64_t val;
-				GetValue(inputData, pos, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
+				const size_t availableSize = inputData.size() - pos - 1;
+				if (byteCodeInfo.DataSize > availableSize) {
+					throw ParsingException("Unexpected end of input archive", 0, pos + 1);
+				}
+				const uint64_t bits = LoadBigEndian(inputData.data() + pos + 1, byteCodeInfo.DataSize, availableSize);
+				pos += 1 + byteCodeInfo.DataSize;
+				return ConvertInteger(byteCodeInfo, bits, outValue, serializationOptions);
 			}
 			// Read from boolean
-			if (byteCode == 0xC2)
-			{
-				++pos;
-				return Detail::ConvertByPolicy(0, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xC3)
+			if (byteCodeInfo.Type == ValueType::Boolean)
 			{
 				++pos;
-				return Detail::ConvertByPolicy(1, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
+				return Detail::ConvertByPolicy(static_cast<int>(byteCode & 1u), outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
 			}
-			HandleMismatchedTypesPolicy(inputData, pos, ByteCodeTable[static_cast<uint_fast8_t>(byteCode)].Type, serializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(inputData, pos, byteCodeInfo.Type, serializationOptions.mismatchedTypesPolicy);
 			return false;
 		}
 		throw ParsingException("No more values to read", 0, pos);
@@ -434,7 +438,7 @@ namespace
 				extTypeInfo.DataOffset = 1 + metaInfo.DataSize + metaInfo.ExtSize;
 				if (pos + extTypeInfo.DataOffset < inputData.size())
 				{
-					extTypeInfo.ExtTypeCode = inputData[pos + 1 + metaInfo.DataSize];
+					extTypeInfo.ExtTypeCode = inputData[pos + 1 + metaInfo.ExtSize];
 					// Currently only timestamp is specified as extension type
 					if (extTypeInfo.ExtTypeCode == '\xFF') {
 						extTypeInfo.ValueType = ValueType::Timestamp;
@@ -447,6 +451,50 @@ namespace
 		}
 		throw ParsingException("No more values to read", 0, pos);
 	}
+
+	/**
+	 * @brief Reads the sequence of floating point numbers which are stored in the same format as the target type.
+	 *
+	 * The type codes are validated for all available items before decoding the values in a tight loop.
+	 * @return The number of read values (stops at the first value in a different format).
+	 */
+	template <typename T>
+	size_t ReadPackedFloats(std::string_view inputData, size_t& pos, T* values, size_t count) noexcept
+	{
+		using bits_type = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+		constexpr char code = sizeof(T) == sizeof(uint32_t) ? '\xCA' : '\xCB';
+		constexpr size_t itemSize = 1 + sizeof(T);
+
+		const char* data = inputData.data() + pos;
+		const size_t availableCount = (std::min)(count, (inputData.size() - pos) / itemSize);
+		size_t packedCount = 0;
+		while (packedCount < availableCount && data[packedCount * itemSize] == code) {
+			++packedCount;
+		}
+
+		for (size_t i = 0; i < packedCount; ++i, data += itemSize)
+		{
+			bits_type buf;
+			std::memcpy(&buf, data + 1, sizeof(T));
+			buf = Memory::BigEndianToNative(buf);
+			std::memcpy(values + i, &buf, sizeof(T));
+		}
+		pos += packedCount * itemSize;
+		return packedCount;
+	}
+
+	template <typename T>
+	void ReadFloats(MsgPack::Detail::CMsgPackStringReader& reader, std::string_view inputData, size_t& pos, T* values, size_t count)
+	{
+		for (size_t i = 0; i < count;)
+		{
+			i += ReadPackedFloats(inputData, pos, values + i, count - i);
+			// Values in other formats are read one by one (with conversion)
+			if (i < count) {
+				reader.ReadValue(values[i++]);
+			}
+		}
+	}
 }
 
 namespace BitSerializer::MsgPack::Detail
@@ -613,40 +661,26 @@ namespace BitSerializer::MsgPack::Detail
 	{
 		if (mPos < mInputData.size())
 		{
-			size_t size;
-			const auto ch = mInputData[mPos];
-			if ((static_cast<uint8_t>(ch) & 0b11100000u) == 0b10100000u)
-			{
-				size = static_cast<uint8_t>(ch) & 0b00011111u;
-				++mPos;
-			}
-			else if (ch == '\xD9')
-			{
-				++mPos;
-				uint8_t sz8;
-				GetValue(mInputData, mPos, sz8);
-				size = sz8;
-			}
-			else if (ch == '\xDA')
-			{
-				++mPos;
-				uint16_t sz16;
-				GetValue(mInputData, mPos, sz16);
-				size = sz16;
-			}
-			else if (ch == '\xDB')
-			{
-				++mPos;
-				uint32_t sz32;
-				GetValue(mInputData, mPos, sz32);
-				size = sz32;
-			}
-			else
+			const auto& byteCodeInfo = ByteCodeTable[static_cast<uint_fast8_t>(mInputData[mPos])];
+			if (byteCodeInfo.Type != ValueType::String)
 			{
 				HandleMismatchedTypesPolicy(mInputData, mPos, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
 				return false;
 			}
 
+			// The size is stored in the byte code (fixstr) or in the following 1-4 bytes (str 8/16/32)
+			size_t size = byteCodeInfo.FixedSeq;
+			++mPos;
+			if (byteCodeInfo.ExtSize)
+			{
+				const size_t availableSize = mInputData.size() - mPos;
+				if (byteCodeInfo.ExtSize > availableSize) {
+					throw ParsingException("Unexpected end of input archive", 0, mPos);
+				}
+				size = static_cast<size_t>(LoadBigEndian(mInputData.data() + mPos, byteCodeInfo.ExtSize, availableSize));
+				mPos += byteCodeInfo.ExtSize;
+			}
+
 			if (mPos + size <= mInputData.size())
 			{
 				value = std::string_view(mInputData.data() + mPos, size);
@@ -727,6 +761,20 @@ namespace BitSerializer::MsgPack::Detail
 		throw ParsingException("No more values to read", 0, mPos);
 	}
 
+	bool CMsgPackStringReader::ReadArraySize(size_t& arraySize, TypedArrayItemType& itemType)
+	{
+		ExtTypeInfo extTypeInfo;
+		if (ReadExtFamilyType(mInputData, mPos, extTypeInfo) && extTypeInfo.ExtTypeCode == typed_array_ext_type && extTypeInfo.Size != 0)
+		{
+			const size_t startPos = mPos;
+			mPos += extTypeInfo.DataOffset;
+			arraySize = GetTypedArraySize(extTypeInfo, ReadBinary(), itemType, startPos);
+			return true;
+		}
+		itemType = TypedArrayItemType::None;
+		return ReadArraySize(arraySize);
+	}
+
 	bool CMsgPackStringReader::ReadMapSize(size_t& mapSize)
 	{
 		if (mPos < mInputData.size())
@@ -772,26 +820,35 @@ namespace BitSerializer::MsgPack::Detail
 				uint8_t sz8;
 				GetValue(mInputData, mPos, sz8);
 				binarySize = sz8;
-				return true;
 			}
-			if (ch == '\xC5')
+			else if (ch == '\xC5')
 			{
 				++mPos;
 				uint16_t sz16;
 				GetValue(mInputData, mPos, sz16);
 				binarySize = sz16;
-				return true;
 			}
-			if (ch == '\xC6')
+			else if (ch == '\xC6')
 			{
 				++mPos;
 				uint32_t sz32;
 				GetValue(mInputData, mPos, sz32);
 				binarySize = sz32;
-				return true;
 			}
-			HandleMismatchedTypesPolicy(mInputData, mPos, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
-			return false;
+			else
+			{
+				// Arrays are not consumed, they can be loaded via array scope (e.g. bytes saved by previous versions)
+				if (const auto valueType = ReadValueType(); valueType != ValueType::Array) {
+					HandleMismatchedTypesPolicy(mInputData, mPos, valueType, mSerializationOptions.mismatchedTypesPolicy);
+				}
+				return false;
+			}
+
+			// Check the declared size before the target container will be allocated
+			if (binarySize > mInputData.size() - mPos) {
+				throw ParsingException("The size of binary array exceeds the size of input data", 0, mPos);
+			}
+			return true;
 		}
 		throw ParsingException("No more values to read", 0, mPos);
 	}
@@ -805,6 +862,81 @@ namespace BitSerializer::MsgPack::Detail
 		throw ParsingException("No more values to read", 0, mPos);
 	}
 
+	void CMsgPackStringReader::ReadBinary(char* data, size_t size)
+	{
+		if (size > mInputData.size() - mPos) {
+			throw ParsingException("No more values to read", 0, mPos);
+		}
+		std::memcpy(data, mInputData.data() + mPos, size);
+		mPos += size;
+	}
+
+	void CMsgPackStringReader::ReadValues(uint8_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(uint16_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(uint32_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(uint64_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(int8_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(int16_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(int32_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(int64_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadInteger(mInputData, mPos, values[i], mSerializationOptions);
+		}
+	}
+
+	void CMsgPackStringReader::ReadValues(float* values, size_t count)
+	{
+		ReadFloats(*this, mInputData, mPos, values, count);
+	}
+
+	void CMsgPackStringReader::ReadValues(double* values, size_t count)
+	{
+		ReadFloats(*this, mInputData, mPos, values, count);
+	}
+
 	void CMsgPackStringReader::SkipValue()
 	{
 		SkipValueImpl(mInputData, mPos);
@@ -813,12 +945,12 @@ namespace BitSerializer::MsgPack::Detail
 
 
 //-----------------------------------------------------------------------------
-// CMsgPackStreamReader
+// CMsgPackBasicStreamReader (std::istream and SegmentedInput)
 //-----------------------------------------------------------------------------
 namespace
 {
-	template <typename T, std::enable_if_t<sizeof(T) == 1 && std::is_integral_v<T>, int> = 0>
-	void GetValue(Detail::CBinaryStreamReader& binaryStreamReader, T& outValue)
+	template <typename TBinaryReader, typename T, std::enable_if_t<sizeof(T) == 1 && std::is_integral_v<T>, int> = 0>
+	void GetValue(TBinaryReader& binaryStreamReader, T& outValue)
 	{
 		if (const auto value = binaryStreamReader.ReadByte())
 		{
@@ -829,19 +961,21 @@ namespace
 		}
 	}
 
-	template <typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
-	void GetValue(Detail::CBinaryStreamReader& binaryStreamReader, T& outValue)
+	template <typename TBinaryReader, typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
+	void GetValue(TBinaryReader& binaryStreamReader, T& outValue)
 	{
 		if (const auto data = binaryStreamReader.ReadExactly(sizeof(T)); !data.empty())
 		{
-			outValue = Memory::BigEndianToNative(*reinterpret_cast<const T*>(data.data()));
+			std::memcpy(&outValue, data.data(), sizeof(T));
+			outValue = Memory::BigEndianToNative(outValue);
 		}
 		else {
 			throw ParsingException("Unexpected end of input archive", 0, binaryStreamReader.GetPosition());
 		}
 	}
 
-	uint32_t ReadExtSize(Detail::CBinaryStreamReader& binaryStreamReader, uint_fast8_t extSizeBytesNum)
+	template <typename TBinaryReader>
+	uint32_t ReadExtSize(TBinaryReader& binaryStreamReader, uint_fast8_t extSizeBytesNum)
 	{
 		if (extSizeBytesNum == 1)
 		{
@@ -864,57 +998,54 @@ namespace
 		throw std::invalid_argument("Internal error: invalid range of 'extSizeBytesNum'");
 	}
 
-	void SkipValueImpl(Detail::CBinaryStreamReader& binaryStreamReader)
+	/**
+	 * @brief Skips the value including all nested arrays and maps (without recursion).
+	 *
+	 * Scalars and length-prefixed values (strings, binary arrays, extensions) are skipped in one step,
+	 * the items of arrays and maps are just added to the counter of pending values.
+	 */
+	template <typename TBinaryReader>
+	void SkipValueImpl(TBinaryReader& binaryStreamReader)
 	{
-		if (const auto byteCode = binaryStreamReader.ReadByte())
+		const size_t startPos = binaryStreamReader.GetPosition();
+
+		// The number of values which remain to skip (keys and values of maps are counted separately)
+		uint64_t pendingValues = 1;
+		do
 		{
+			const auto byteCode = binaryStreamReader.ReadByte();
+			if (!byteCode)
+			{
+				const auto pos = binaryStreamReader.GetPosition();
+				throw ParsingException(pos == startPos ? "No more values to read" : "Unexpected end of input archive", 0, pos);
+			}
 			const auto& byteCodeInfo = ByteCodeTable[static_cast<uint_fast8_t>(*byteCode)];
+			--pendingValues;
 
 			size_t size = byteCodeInfo.DataSize;
-			uint32_t extSize = 0;
-			if (byteCodeInfo.FixedSeq)
-			{
-				extSize += byteCodeInfo.FixedSeq;
-			}
-			else if (byteCodeInfo.ExtSize)
-			{
-				extSize = ReadExtSize(binaryStreamReader, byteCodeInfo.ExtSize);
+			uint32_t seqSize = byteCodeInfo.FixedSeq;
+			if (byteCodeInfo.ExtSize) {
+				seqSize = ReadExtSize(binaryStreamReader, byteCodeInfo.ExtSize);
 			}
 
-			if (byteCodeInfo.Type == ValueType::String || byteCodeInfo.Type == ValueType::BinaryArray || byteCodeInfo.Type == ValueType::Ext)
-			{
-				size += extSize;
-				extSize = 0;
+			if (byteCodeInfo.Type == ValueType::Array) {
+				pendingValues += seqSize;
+			}
+			else if (byteCodeInfo.Type == ValueType::Map) {
+				pendingValues += static_cast<uint64_t>(seqSize) * 2;
+			}
+			else if (byteCodeInfo.Type == ValueType::String || byteCodeInfo.Type == ValueType::BinaryArray || byteCodeInfo.Type == ValueType::Ext) {
+				size += seqSize;
 			}
 
-			if (size == 0 || binaryStreamReader.SetPosition(binaryStreamReader.GetPosition() + size))
-			{
-				if (extSize)
-				{
-					if (byteCodeInfo.Type == ValueType::Map)
-					{
-						for (uint32_t i = 0; i < extSize; ++i)
-						{
-							SkipValueImpl(binaryStreamReader);
-							SkipValueImpl(binaryStreamReader);
-						}
-					}
-					else if (byteCodeInfo.Type == ValueType::Array)
-					{
-						for (uint32_t i = 0; i < extSize; ++i)
-						{
-							SkipValueImpl(binaryStreamReader);
-						}
-					}
-				}
-				return;
+			if (size != 0 && !binaryStreamReader.SetPosition(binaryStreamReader.GetPosition() + size)) {
+				throw ParsingException("Unexpected end of input archive", 0, binaryStreamReader.GetPosition());
 			}
-			throw ParsingException("Unexpected end of input archive", 0, binaryStreamReader.GetPosition());
-		}
-		throw ParsingException("No more values to read", 0, binaryStreamReader.GetPosition());
+		} while (pendingValues != 0);
 	}
 
-	void HandleMismatchedTypesPolicy(Detail::CBinaryStreamReader& binaryStreamReader, ValueType actualType, MismatchedTypesPolicy mismatchedTypesPolicy)
+	template <typename TBinaryReader>
+	void HandleMismatchedTypesPolicy(TBinaryReader& binaryStreamReader, ValueType actualType, MismatchedTypesPolicy mismatchedTypesPolicy)
 	{
 		// Null value is excluded from MismatchedTypesPolicy processing
 		if (actualType != ValueType::Nil && mismatchedTypesPolicy == MismatchedTypesPolicy::ThrowError)
@@ -925,91 +1056,44 @@ namespace
 		SkipValueImpl(binaryStreamReader);
 	}
 
-	template <typename T>
-	bool ReadInteger(Detail::CBinaryStreamReader& binaryStreamReader, T& outValue, const SerializationOptions& serializationOptions)
+	template <typename TBinaryReader, typename T>
+	bool ReadInteger(TBinaryReader& binaryStreamReader, T& outValue, const SerializationOptions& serializationOptions)
 	{
 		if (const auto optByteCode = binaryStreamReader.PeekByte())
 		{
 			const auto byteCode = static_cast<uint_fast8_t>(optByteCode.value());
+			// Fast path for fixed positive and negative integers
 			if (byteCode < 0x80 || byteCode >= 0xE0)
 			{
 				binaryStreamReader.GotoNextByte();
 				return Detail::ConvertByPolicy(static_cast<int8_t>(byteCode), outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
 			}
-			if (byteCode == 0xCC)
-			{
-				binaryStreamReader.GotoNextByte();
-				uint8_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xCD)
-			{
-				binaryStreamReader.GotoNextByte();
-				uint16_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xCE)
-			{
-				binaryStreamReader.GotoNextByte();
-				uint32_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xCF)
-			{
-				binaryStreamReader.GotoNextByte();
-				uint64_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD0)
-			{
-				binaryStreamReader.GotoNextByte();
-				int8_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD1)
-			{
-				binaryStreamReader.GotoNextByte();
-				int16_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD2)
-			{
-				binaryStreamReader.GotoNextByte();
-				int32_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xD3)
+
+			const auto& byteCodeInfo = ByteCodeTable[byteCode];
+			if (byteCodeInfo.Type == ValueType::UnsignedInteger || byteCodeInfo.Type == ValueType::SignedInteger)
 			{
 				binaryStreamReader.GotoNextByte();
-				int64_t val;
-				GetValue(binaryStreamReader, val);
-				return Detail::ConvertByPolicy(val, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
+				const auto data = binaryStreamReader.ReadExactly(byteCodeInfo.DataSize);
+				if (data.empty()) {
+					throw ParsingException("Unexpected end of input archive", 0, binaryStreamReader.GetPosition());
+				}
+				const uint64_t bits = LoadBigEndian(data.data(), byteCodeInfo.DataSize, data.size());
+				return ConvertInteger(byteCodeInfo, bits, outValue, serializationOptions);
 			}
 			// Read from boolean
-			if (byteCode == 0xC2)
-			{
-				binaryStreamReader.GotoNextByte();
-				return Detail::ConvertByPolicy(0, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
-			}
-			if (byteCode == 0xC3)
+			if (byteCodeInfo.Type == ValueType::Boolean)
 			{
 				binaryStreamReader.GotoNextByte();
-				return Detail::ConvertByPolicy(1, outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
+				return Detail::ConvertByPolicy(static_cast<int>(byteCode & 1u), outValue, serializationOptions.mismatchedTypesPolicy, serializationOptions.overflowNumberPolicy);
 			}
-			HandleMismatchedTypesPolicy(binaryStreamReader, ByteCodeTable[byteCode].Type, serializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(binaryStreamReader, byteCodeInfo.Type, serializationOptions.mismatchedTypesPolicy);
 			return false;
 		}
 		throw ParsingException("No more values to read", 0, binaryStreamReader.GetPosition());
 	}
 
-	bool ReadExtFamilyType(Detail::CBinaryStreamReader& binaryStreamReader, ExtTypeInfo& extTypeInfo)
+	template <typename TBinaryReader>
+	bool ReadExtFamilyType(TBinaryReader& binaryStreamReader, ExtTypeInfo& extTypeInfo)
 	{
 		if (const auto byteCode = binaryStreamReader.PeekByte())
 		{
@@ -1060,219 +1144,272 @@ namespace
 		}
 		throw ParsingException("No more values to read", 0, binaryStreamReader.GetPosition());
 	}
+
+	std::unique_ptr<Detail::CBinaryStreamReader> MakeBinaryReader(std::istream& inputStream, const SerializationOptions& serializationOptions)
+	{
+		return std::make_unique<Detail::CBinaryStreamReader>(inputStream,
+			serializationOptions.streamOptions.readBufferSize, serializationOptions.streamOptions.growReadBuffer);
+	}
+
+	std::unique_ptr<Detail::CBinarySegmentsReader> MakeBinaryReader(const SegmentedInput& input, const SerializationOptions&)
+	{
+		return std::make_unique<Detail::CBinarySegmentsReader>(input);
+	}
 }
 
 namespace BitSerializer::MsgPack::Detail
 {
-	CMsgPackStreamReader::CMsgPackStreamReader(std::istream& inputStream, const SerializationOptions& serializationOptions) noexcept
-		: mBinaryStreamReader(inputStream)
+	template <typename TInput>
+	CMsgPackBasicStreamReader<TInput>::CMsgPackBasicStreamReader(input_ref_type input, const SerializationOptions& serializationOptions)
+		: mBinaryStreamReader(MakeBinaryReader(input, serializationOptions))
 		, mSerializationOptions(serializationOptions)
 	{ }
 
-	ValueType CMsgPackStreamReader::ReadValueType()
+	template <typename TInput>
+	CMsgPackBasicStreamReader<TInput>::~CMsgPackBasicStreamReader() = default;
+
+	template <typename TInput>
+	size_t CMsgPackBasicStreamReader<TInput>::GetPosition() const noexcept
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		return mBinaryStreamReader->GetPosition();
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::SetPosition(size_t pos)
+	{
+		mBinaryStreamReader->SetPosition(pos);
+	}
+
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::IsEnd() const noexcept
+	{
+		return mBinaryStreamReader->IsEnd();
+	}
+
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::HasMoreData()
+	{
+		return mBinaryStreamReader->PeekByte().has_value();
+	}
+
+	template <typename TInput>
+	ValueType CMsgPackBasicStreamReader<TInput>::ReadValueType()
+	{
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			const auto& metaInfo = ByteCodeTable[static_cast<uint8_t>(*byteCode)];
 			if (metaInfo.Type == ValueType::Ext)
 			{
 				ExtTypeInfo extTypeInfo;
-				ReadExtFamilyType(mBinaryStreamReader, extTypeInfo);
+				ReadExtFamilyType(*mBinaryStreamReader, extTypeInfo);
 				return extTypeInfo.ValueType;
 			}
 			return metaInfo.Type;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadValue(std::nullptr_t&)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(std::nullptr_t&)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			if (byteCode.value() == '\xC0')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				return true;
 			}
-			HandleMismatchedTypesPolicy(mBinaryStreamReader, ByteCodeTable[static_cast<uint8_t>(*byteCode)].Type, mSerializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(*mBinaryStreamReader, ByteCodeTable[static_cast<uint8_t>(*byteCode)].Type, mSerializationOptions.mismatchedTypesPolicy);
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadValue(bool& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(bool& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(uint8_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(uint8_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(uint16_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(uint16_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(uint32_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(uint32_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(uint64_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(uint64_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(char& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(char& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(int8_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(int8_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(int16_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(int16_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(int32_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(int32_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(int64_t& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(int64_t& value)
 	{
-		return ReadInteger(mBinaryStreamReader, value, mSerializationOptions);
+		return ReadInteger(*mBinaryStreamReader, value, mSerializationOptions);
 	}
 
-	bool CMsgPackStreamReader::ReadValue(float& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(float& value)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			if (*byteCode == '\xCA')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint32_t buf;
-				GetValue(mBinaryStreamReader, buf);
+				GetValue(*mBinaryStreamReader, buf);
 				std::memcpy(&value, &buf, sizeof(uint32_t));
 				return true;
 			}
 			if (*byteCode == '\xCB')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint64_t buf;
-				GetValue(mBinaryStreamReader, buf);
+				GetValue(*mBinaryStreamReader, buf);
 				double temp;
 				std::memcpy(&temp, &buf, sizeof(uint64_t));
 				return BitSerializer::Detail::ConvertByPolicy(temp, value, mSerializationOptions.mismatchedTypesPolicy, mSerializationOptions.overflowNumberPolicy);
 			}
 
-			HandleMismatchedTypesPolicy(mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(*mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
 			return false;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadValue(double& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(double& value)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			if (*byteCode == '\xCB')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint64_t buf;
-				GetValue(mBinaryStreamReader, buf);
+				GetValue(*mBinaryStreamReader, buf);
 				std::memcpy(&value, &buf, sizeof(uint64_t));
 				return true;
 			}
 			if (*byteCode == '\xCA')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint32_t buf;
-				GetValue(mBinaryStreamReader, buf);
+				GetValue(*mBinaryStreamReader, buf);
 				float temp;
 				std::memcpy(&temp, &buf, sizeof(uint32_t));
 				value = static_cast<double>(temp);
 				return true;
 			}
 
-			HandleMismatchedTypesPolicy(mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(*mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
 			return false;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadValue(std::string_view& value)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(std::string_view& value)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
-			size_t remainingSize;
-			if ((static_cast<uint8_t>(*byteCode) & 0b11100000u) == 0b10100000u)
-			{
-				remainingSize = static_cast<uint8_t>(*byteCode) & 0b00011111u;
-				mBinaryStreamReader.GotoNextByte();
-			}
-			else if (*byteCode == '\xD9')
-			{
-				mBinaryStreamReader.GotoNextByte();
-				uint8_t sz8;
-				GetValue(mBinaryStreamReader, sz8);
-				remainingSize = sz8;
-			}
-			else if (*byteCode == '\xDA')
+			const auto& byteCodeInfo = ByteCodeTable[static_cast<uint_fast8_t>(*byteCode)];
+			if (byteCodeInfo.Type != ValueType::String)
 			{
-				mBinaryStreamReader.GotoNextByte();
-				uint16_t sz16;
-				GetValue(mBinaryStreamReader, sz16);
-				remainingSize = sz16;
+				HandleMismatchedTypesPolicy(*mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
+				return false;
 			}
-			else if (*byteCode == '\xDB')
+
+			// The size is stored in the byte code (fixstr) or in the following 1-4 bytes (str 8/16/32)
+			size_t remainingSize = byteCodeInfo.FixedSeq;
+			mBinaryStreamReader->GotoNextByte();
+			if (byteCodeInfo.ExtSize)
 			{
-				mBinaryStreamReader.GotoNextByte();
-				uint32_t sz32;
-				GetValue(mBinaryStreamReader, sz32);
-				remainingSize = sz32;
+				const auto data = mBinaryStreamReader->ReadExactly(byteCodeInfo.ExtSize);
+				if (data.empty()) {
+					throw ParsingException("Unexpected end of input archive", 0, mBinaryStreamReader->GetPosition());
+				}
+				remainingSize = static_cast<size_t>(LoadBigEndian(data.data(), byteCodeInfo.ExtSize, data.size()));
 			}
-			else
+
+			// Return the string directly from the window of stream reader when it fits (avoids copying)
+			if (remainingSize <= mBinaryStreamReader->GetMaxBlockSize())
 			{
-				HandleMismatchedTypesPolicy(mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
-				return false;
+				value = mBinaryStreamReader->ReadExactly(remainingSize);
+				if (value.size() != remainingSize) {
+					throw ParsingException("Unexpected end of input archive", 0, mBinaryStreamReader->GetPosition());
+				}
+				return true;
 			}
 
+			// Large strings are assembled into the internal buffer (it grows while data arrives, as the size can't be trusted)
+			constexpr size_t maxReserveSize = 64 * 1024;
 			mBuffer.clear();
-			mBuffer.reserve(remainingSize);
+			mBuffer.reserve((std::min)(remainingSize, maxReserveSize));
 			while (remainingSize != 0)
 			{
-				if (const std::string_view chunk = mBinaryStreamReader.ReadUpTo(remainingSize); !chunk.empty())
+				if (const std::string_view chunk = mBinaryStreamReader->ReadUpTo(remainingSize); !chunk.empty())
 				{
 					mBuffer += chunk;
 					remainingSize -= chunk.size();
 				}
 				else
 				{
-					throw ParsingException("Unexpected end of input archive", 0, mBinaryStreamReader.GetPosition());
+					throw ParsingException("Unexpected end of input archive", 0, mBinaryStreamReader->GetPosition());
 				}
 			}
 			value = mBuffer;
 			return true;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadValue(CBinTimestamp& timestamp)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadValue(CBinTimestamp& timestamp)
 	{
 		ExtTypeInfo extTypeInfo;
-		if (ReadExtFamilyType(mBinaryStreamReader, extTypeInfo) && extTypeInfo.ExtTypeCode == '\xFF')
+		if (ReadExtFamilyType(*mBinaryStreamReader, extTypeInfo) && extTypeInfo.ExtTypeCode == '\xFF')
 		{
-			mBinaryStreamReader.SetPosition(mBinaryStreamReader.GetPosition() + extTypeInfo.DataOffset);
+			mBinaryStreamReader->SetPosition(mBinaryStreamReader->GetPosition() + extTypeInfo.DataOffset);
 			if (extTypeInfo.Size == 4)
 			{
 				uint32_t data32;
-				GetValue(mBinaryStreamReader, data32);
+				GetValue(*mBinaryStreamReader, data32);
 				timestamp.Seconds = data32;
 				timestamp.Nanoseconds = 0;
 				return true;
@@ -1280,133 +1417,316 @@ namespace BitSerializer::MsgPack::Detail
 			if (extTypeInfo.Size == 8)
 			{
 				uint64_t data64;
-				GetValue(mBinaryStreamReader, data64);
+				GetValue(*mBinaryStreamReader, data64);
 				timestamp.Seconds = static_cast<int64_t>(data64 & 0x00000003FFFFFFFFul);
 				timestamp.Nanoseconds = static_cast<int32_t>(data64 >> 34u);
 				return true;
 			}
 			if (extTypeInfo.Size == 12)
 			{
-				GetValue(mBinaryStreamReader, timestamp.Seconds);
-				GetValue(mBinaryStreamReader, timestamp.Nanoseconds);
+				GetValue(*mBinaryStreamReader, timestamp.Seconds);
+				GetValue(*mBinaryStreamReader, timestamp.Nanoseconds);
 				return true;
 			}
 			throw SerializationException(SerializationErrorCode::ParsingError,
 				"Invalid size of timestamp: " + Convert::ToString(extTypeInfo.Size));
 		}
-		HandleMismatchedTypesPolicy(mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
+		HandleMismatchedTypesPolicy(*mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
 		return false;
 	}
 
-	bool CMsgPackStreamReader::ReadArraySize(size_t& arraySize)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadArraySize(size_t& arraySize)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			if ((static_cast<uint8_t>(*byteCode) & 0b11110000u) == 0b10010000u)
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				arraySize = static_cast<uint8_t>(*byteCode) & 0b00001111u;
 				return true;
 			}
 			if (*byteCode == '\xDC')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint16_t sz16;
-				GetValue(mBinaryStreamReader, sz16);
+				GetValue(*mBinaryStreamReader, sz16);
 				arraySize = sz16;
 				return true;
 			}
 			if (*byteCode == '\xDD')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint32_t sz32;
-				GetValue(mBinaryStreamReader, sz32);
+				GetValue(*mBinaryStreamReader, sz32);
 				arraySize = sz32;
 				return true;
 			}
 
-			HandleMismatchedTypesPolicy(mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(*mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
 			return false;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadMapSize(size_t& mapSize)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadArraySize(size_t& arraySize, TypedArrayItemType& itemType)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		ExtTypeInfo extTypeInfo;
+		if (ReadExtFamilyType(*mBinaryStreamReader, extTypeInfo) && extTypeInfo.ExtTypeCode == typed_array_ext_type && extTypeInfo.Size != 0)
+		{
+			const size_t startPos = mBinaryStreamReader->GetPosition();
+			mBinaryStreamReader->SetPosition(startPos + extTypeInfo.DataOffset);
+			arraySize = GetTypedArraySize(extTypeInfo, ReadBinary(), itemType, startPos);
+			return true;
+		}
+		itemType = TypedArrayItemType::None;
+		return ReadArraySize(arraySize);
+	}
+
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadMapSize(size_t& mapSize)
+	{
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			if ((static_cast<uint8_t>(*byteCode) & 0b11110000u) == 0b10000000u)
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				mapSize = static_cast<uint8_t>(*byteCode) & 0b00001111u;
 				return true;
 			}
 			if (*byteCode == '\xDE')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint16_t sz16;
-				GetValue(mBinaryStreamReader, sz16);
+				GetValue(*mBinaryStreamReader, sz16);
 				mapSize = sz16;
 				return true;
 			}
 			if (*byteCode == '\xDF')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint32_t sz32;
-				GetValue(mBinaryStreamReader, sz32);
+				GetValue(*mBinaryStreamReader, sz32);
 				mapSize = sz32;
 				return true;
 			}
 
-			HandleMismatchedTypesPolicy(mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
+			HandleMismatchedTypesPolicy(*mBinaryStreamReader, ReadValueType(), mSerializationOptions.mismatchedTypesPolicy);
 			return false;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	bool CMsgPackStreamReader::ReadBinarySize(size_t& binarySize)
+	template <typename TInput>
+	bool CMsgPackBasicStreamReader<TInput>::ReadBinarySize(size_t& binarySize)
 	{
-		if (const auto byteCode = mBinaryStreamReader.PeekByte())
+		if (const auto byteCode = mBinaryStreamReader->PeekByte())
 		{
 			if (*byteCode == '\xC4')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint8_t sz8;
-				GetValue(mBinaryStreamReader, sz8);
+				GetValue(*mBinaryStreamReader, sz8);
 				binarySize = sz8;
 				return true;
 			}
 			if (*byteCode == '\xC5')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint16_t sz16;
-				GetValue(mBinaryStreamReader, sz16);
+				GetValue(*mBinaryStreamReader, sz16);
 				binarySize = sz16;
 				return true;
 			}
 			if (*byteCode == '\xC6')
 			{
-				mBinaryStreamReader.GotoNextByte();
+				mBinaryStreamReader->GotoNextByte();
 				uint32_t sz32;
-				GetValue(mBinaryStreamReader, sz32);
+				GetValue(*mBinaryStreamReader, sz32);
 				binarySize = sz32;
 				return true;
 			}
+
+			// Arrays are not consumed, they can be loaded via array scope (e.g. bytes saved by previous versions)
+			if (const auto valueType = ReadValueType(); valueType != ValueType::Array) {
+				HandleMismatchedTypesPolicy(*mBinaryStreamReader, valueType, mSerializationOptions.mismatchedTypesPolicy);
+			}
+			return false;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
 	}
 
-	char CMsgPackStreamReader::ReadBinary()
+	template <typename TInput>
+	char CMsgPackBasicStreamReader<TInput>::ReadBinary()
 	{
-		if (const auto byteCode = mBinaryStreamReader.ReadByte())
+		if (const auto byteCode = mBinaryStreamReader->ReadByte())
 		{
 			return *byteCode;
 		}
-		throw ParsingException("No more values to read", 0, mBinaryStreamReader.GetPosition());
+		throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadBinary(char* data, size_t size)
+	{
+		while (size != 0)
+		{
+			const auto block = mBinaryStreamReader->ReadUpTo(size);
+			if (block.empty()) {
+				throw ParsingException("No more values to read", 0, mBinaryStreamReader->GetPosition());
+			}
+			std::memcpy(data, block.data(), block.size());
+			data += block.size();
+			size -= block.size();
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(uint8_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(uint16_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(uint32_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(uint64_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(int8_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(int16_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(int32_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(int64_t* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(float* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::ReadValues(double* values, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			ReadValue(values[i]);
+		}
+	}
+
+	template <typename TInput>
+	void CMsgPackBasicStreamReader<TInput>::SkipValue()
+	{
+		SkipValueImpl(*mBinaryStreamReader);
+	}
+
+	template class CMsgPackBasicStreamReader<std::istream>;
+	template class CMsgPackBasicStreamReader<SegmentedInput>;
+}
+
+
+//-----------------------------------------------------------------------------
+// CMsgPackValueScanner
+//-----------------------------------------------------------------------------
+namespace BitSerializer::MsgPack::Detail
+{
+	size_t CMsgPackValueScanner::Scan(std::string_view data)
+	{
+		// Each value is scanned only when its header and data are fully received
+		while (mPendingValues != 0)
+		{
+			if (mPos >= data.size()) {
+				return 0;
+			}
+			const auto& byteCodeInfo = ByteCodeTable[static_cast<uint_fast8_t>(data[mPos])];
+
+			size_t pos = mPos + 1;
+			uint64_t size = byteCodeInfo.DataSize;
+			uint32_t seqSize = byteCodeInfo.FixedSeq;
+			if (byteCodeInfo.ExtSize)
+			{
+				if (byteCodeInfo.ExtSize > data.size() - pos) {
+					return 0;
+				}
+				seqSize = ReadExtSize(byteCodeInfo.ExtSize, data, pos);
+				size += byteCodeInfo.ExtSize;
+			}
+
+			if (byteCodeInfo.Type == ValueType::String || byteCodeInfo.Type == ValueType::BinaryArray || byteCodeInfo.Type == ValueType::Ext) {
+				size += seqSize;
+			}
+			// Each pending item takes at least one byte, so their number is also checked against the maximum size
+			uint64_t pendingValues = mPendingValues - 1;
+			if (byteCodeInfo.Type == ValueType::Array) {
+				pendingValues += seqSize;
+			}
+			else if (byteCodeInfo.Type == ValueType::Map) {
+				pendingValues += static_cast<uint64_t>(seqSize) * 2;
+			}
+			if (pos > mMaxValueSize || size > mMaxValueSize - pos || pendingValues > mMaxValueSize - pos - size) {
+				throw ParsingException("The size of value exceeds the maximum size of message", 0, mPos);
+			}
+
+			if (size > data.size() - pos) {
+				return 0;
+			}
+			mPos = pos + static_cast<size_t>(size);
+			mPendingValues = pendingValues;
+		}
+		return mPos;
 	}
 
-	void CMsgPackStreamReader::SkipValue()
+	void CMsgPackValueScanner::Reset() noexcept
 	{
-		SkipValueImpl(mBinaryStreamReader);
+		mPos = 0;
+		mPendingValues = 1;
 	}
 }
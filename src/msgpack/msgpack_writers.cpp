@@ -2,77 +2,258 @@
 * Copyright (C) 2018-2025 by Pavel Kisliak                                     *
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
-#include "msgpack_writers.h"
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include "bitserializer/msgpack_archive.h"
 #include "bitserializer/common/memory.h"
 
 namespace
 {
 	using namespace BitSerializer;
 
-	template <typename T, std::enable_if_t<sizeof(T) == 1 && std::is_integral_v<T>, int> = 0>
-	void PushValue(std::string& outputString, char code, T value)
+	/// The number of nesting levels of maps, for which is remembered whether the previous map was large (bits of `uint64_t`).
+	constexpr size_t max_predicted_maps_depth = 64;
+	/// The flag in the position of map's header, which marks that the header of "map16" was reserved.
+	constexpr size_t map16_header_flag = ~((std::numeric_limits<size_t>::max)() >> 1);
+
+	template <typename TOutput, typename T, std::enable_if_t<sizeof(T) == 1 && std::is_integral_v<T>, int> = 0>
+	void PushValue(TOutput& outputString, char code, T value)
 	{
 		outputString.push_back(static_cast<char>(static_cast<uint8_t>(code)));
 		outputString.push_back(static_cast<char>(value));
 	}
 
-	template <typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
-	void PushValue(std::string& outputString, char code, T value)
+	template <typename TOutput, typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
+	void PushValue(TOutput& outputString, char code, T value)
 	{
 		outputString.push_back(static_cast<char>(static_cast<uint8_t>(code)));
 		const T networkVal = Memory::NativeToBigEndian(value);
 		outputString.append(reinterpret_cast<const char*>(&networkVal), sizeof(T));
 	}
 
-	template <typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
-	void PushValue(std::string& outputString, T value)
+	template <typename TOutput, typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
+	void PushValue(TOutput& outputString, T value)
 	{
 		const T networkVal = Memory::NativeToBigEndian(value);
 		outputString.append(reinterpret_cast<const char*>(&networkVal), sizeof(T));
 	}
 
-	//------------------------------------------------------------------------------
+	template <typename T>
+	char* EncodeValue(char* out, char code, T value) noexcept
+	{
+		*out++ = code;
+		const T networkVal = Memory::NativeToBigEndian(value);
+		std::memcpy(out, &networkVal, sizeof(T));
+		return out + sizeof(T);
+	}
+
+	/**
+	 * @brief Encodes the number in the same format as `CMsgPackStringWriter::WriteValue()`.
+	 *
+	 * The output buffer must have enough space for the largest format (1 + sizeof(T) bytes).
+	 * @return Pointer to the next byte after the encoded value.
+	 */
+	template <typename T>
+	char* EncodeNumber(char* out, T value) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			using bits_type = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+			bits_type buf;
+			std::memcpy(&buf, &value, sizeof(T));
+			return EncodeValue(out, sizeof(T) == sizeof(uint32_t) ? '\xCA' : '\xCB', buf);
+		}
+		else if constexpr (std::is_unsigned_v<T>)
+		{
+			if (value < 128u)
+			{
+				*out = static_cast<char>(value);
+				return out + 1;
+			}
+			if constexpr (sizeof(T) > sizeof(uint8_t))
+			{
+				if (value > std::numeric_limits<uint8_t>::max())
+				{
+					if constexpr (sizeof(T) > sizeof(uint16_t))
+					{
+						if (value > std::numeric_limits<uint16_t>::max())
+						{
+							if constexpr (sizeof(T) > sizeof(uint32_t))
+							{
+								if (value > std::numeric_limits<uint32_t>::max()) {
+									return EncodeValue(out, '\xCF', static_cast<uint64_t>(value));
+								}
+							}
+							return EncodeValue(out, '\xCE', static_cast<uint32_t>(value));
+						}
+					}
+					return EncodeValue(out, '\xCD', static_cast<uint16_t>(value));
+				}
+			}
+			*out++ = '\xCC';
+			*out = static_cast<char>(value);
+			return out + 1;
+		}
+		else
+		{
+			if constexpr (sizeof(T) > sizeof(int8_t))
+			{
+				if (value < std::numeric_limits<int8_t>::min() || value > std::numeric_limits<int8_t>::max())
+				{
+					if constexpr (sizeof(T) > sizeof(int16_t))
+					{
+						if (value < std::numeric_limits<int16_t>::min() || value > std::numeric_limits<int16_t>::max())
+						{
+							if constexpr (sizeof(T) > sizeof(int32_t))
+							{
+								if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
+									return EncodeValue(out, '\xD3', static_cast<int64_t>(value));
+								}
+							}
+							return EncodeValue(out, '\xD2', static_cast<int32_t>(value));
+						}
+					}
+					return EncodeValue(out, '\xD1', static_cast<int16_t>(value));
+				}
+			}
+			if (value < -32) {
+				*out++ = '\xD0';
+			}
+			*out = static_cast<char>(value);
+			return out + 1;
+		}
+	}
+
+	/**
+	 * @brief Returns the size of number encoded in the same format as `EncodeNumber()`.
+	 */
+	template <typename T>
+	size_t GetEncodedNumberSize(T value) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			return 1 + sizeof(T);
+		}
+		else if constexpr (std::is_unsigned_v<T>)
+		{
+			if (value < 128u) {
+				return 1;
+			}
+			if (value <= std::numeric_limits<uint8_t>::max()) {
+				return 1 + sizeof(uint8_t);
+			}
+			if (value <= std::numeric_limits<uint16_t>::max()) {
+				return 1 + sizeof(uint16_t);
+			}
+			if (value <= std::numeric_limits<uint32_t>::max()) {
+				return 1 + sizeof(uint32_t);
+			}
+			return 1 + sizeof(uint64_t);
+		}
+		else
+		{
+			if (value >= -32 && value <= std::numeric_limits<int8_t>::max()) {
+				return 1;
+			}
+			if (value >= std::numeric_limits<int8_t>::min() && value <= std::numeric_limits<int8_t>::max()) {
+				return 1 + sizeof(int8_t);
+			}
+			if (value >= std::numeric_limits<int16_t>::min() && value <= std::numeric_limits<int16_t>::max()) {
+				return 1 + sizeof(int16_t);
+			}
+			if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+				return 1 + sizeof(int32_t);
+			}
+			return 1 + sizeof(int64_t);
+		}
+	}
+
+	template <typename T>
+	size_t GetEncodedNumbersSize(const T* values, size_t count) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			return count * (1 + sizeof(T));
+		}
+		else
+		{
+			size_t size = 0;
+			for (size_t i = 0; i < count; ++i) {
+				size += GetEncodedNumberSize(values[i]);
+			}
+			return size;
+		}
+	}
 
-	template <typename T, std::enable_if_t<sizeof(T) == 1 && std::is_integral_v<T>, int> = 0>
-	void PushValue(std::ostream& outputStream, char code, T value)
+	/**
+	 * @brief Encodes the sequence of numbers, the output string is resized only once (for the exact size of encoded numbers).
+	 *
+	 * The `FixedOutputBuffer` cannot grow, so numbers are encoded in parts via the small buffer on the stack.
+	 */
+	template <typename TOutput, typename T>
+	void PushValues(TOutput& outputString, const T* values, size_t count)
 	{
-		outputStream.put(static_cast<char>(static_cast<uint8_t>(code)));
-		outputStream.put(static_cast<char>(value));
+		if constexpr (std::is_same_v<TOutput, FixedOutputBuffer>)
+		{
+			constexpr size_t maxValueSize = 1 + sizeof(T);
+			char buffer[maxValueSize * 64];
+			for (size_t i = 0; i < count;)
+			{
+				char* out = buffer;
+				for (const size_t endIndex = (std::min)(i + 64, count); i < endIndex; ++i) {
+					out = EncodeNumber(out, values[i]);
+				}
+				outputString.append(buffer, static_cast<size_t>(out - buffer));
+			}
+		}
+		else
+		{
+			const size_t startPos = outputString.size();
+			outputString.resize(startPos + GetEncodedNumbersSize(values, count));
+			char* out = outputString.data() + startPos;
+			for (size_t i = 0; i < count; ++i) {
+				out = EncodeNumber(out, values[i]);
+			}
+		}
 	}
 
-	template <typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
-	void PushValue(std::ostream& outputStream, char code, T value)
+	template <typename TOutput>
+	void SetByte(TOutput& outputString, size_t pos, char byte)
 	{
-		outputStream.put(static_cast<char>(static_cast<uint8_t>(code)));
-		const auto networkVal = Memory::NativeToBigEndian(value);
-		outputStream.write(reinterpret_cast<const char*>(&networkVal), sizeof(T));
+		outputString[pos] = byte;
 	}
 
-	template <typename T, std::enable_if_t<sizeof(T) >= 2 && std::is_integral_v<T>, int> = 0>
-	void PushValue(std::ostream& outputStream, T value)
+	void SetByte(FixedOutputBuffer& outputBuffer, size_t pos, char byte) noexcept
 	{
-		const auto networkVal = Memory::NativeToBigEndian(value);
-		outputStream.write(reinterpret_cast<const char*>(&networkVal), sizeof(T));
+		// The position may be out of buffer when it is overflowed
+		if (pos < outputBuffer.capacity()) {
+			outputBuffer.data()[pos] = byte;
+		}
 	}
 }
 
 namespace BitSerializer::MsgPack::Detail
 {
-	CMsgPackStringWriter::CMsgPackStringWriter(std::string& outputString)
-		: mOutputString(outputString)
+	template <typename TOutput>
+	CMsgPackBasicStringWriter<TOutput>::CMsgPackBasicStringWriter(output_ref_type outputString, const SerializationOptions&)
+		: mOutputString(std::forward<output_ref_type>(outputString))
 	{ }
 
-	void CMsgPackStringWriter::WriteValue(std::nullptr_t)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(std::nullptr_t)
 	{
 		mOutputString.push_back('\xC0');
 	}
 
-	void CMsgPackStringWriter::WriteValue(bool value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(bool value)
 	{
 		mOutputString.push_back(value ? '\xC3' : '\xC2');
 	}
 
-	void CMsgPackStringWriter::WriteValue(uint8_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(uint8_t value)
 	{
 		if (value >= 128u) {
 			mOutputString.push_back('\xCC');
@@ -80,7 +261,8 @@ namespace BitSerializer::MsgPack::Detail
 		mOutputString.push_back(static_cast<char>(value));
 	}
 
-	void CMsgPackStringWriter::WriteValue(uint16_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(uint16_t value)
 	{
 		if (value > std::numeric_limits<uint8_t>::max()) {
 			PushValue(mOutputString, '\xCD', value);
@@ -90,7 +272,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(uint32_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(uint32_t value)
 	{
 		if (value > std::numeric_limits<uint16_t>::max()) {
 			PushValue(mOutputString, '\xCE', value);
@@ -100,7 +283,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(uint64_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(uint64_t value)
 	{
 		if (value > std::numeric_limits<uint32_t>::max()) {
 			PushValue(mOutputString, '\xCF', value);
@@ -110,7 +294,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(int8_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(int8_t value)
 	{
 		if (value >= -32) {
 			mOutputString.push_back(value);
@@ -120,7 +305,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(int16_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(int16_t value)
 	{
 		if (value < std::numeric_limits<int8_t>::min() || value > std::numeric_limits<int8_t>::max()) {
 			PushValue(mOutputString, '\xD1', value);
@@ -130,7 +316,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(int32_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(int32_t value)
 	{
 		if (value < std::numeric_limits<int16_t>::min() || value > std::numeric_limits<int16_t>::max()) {
 			PushValue(mOutputString, '\xD2', value);
@@ -140,7 +327,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(int64_t value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(int64_t value)
 	{
 		if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
 			PushValue(mOutputString, '\xD3', value);
@@ -150,44 +338,54 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::WriteValue(float value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(float value)
 	{
 		uint32_t buf;
 		std::memcpy(&buf, &value, sizeof(uint32_t));
 		PushValue(mOutputString, '\xCA', buf);
 	}
 
-	void CMsgPackStringWriter::WriteValue(double value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(double value)
 	{
 		uint64_t buf;
 		std::memcpy(&buf, &value, sizeof(uint64_t));
 		PushValue(mOutputString, '\xCB', buf);
 	}
 
-	void CMsgPackStringWriter::WriteValue(std::string_view value)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(std::string_view value)
+	{
+		BeginString(value.size());
+		mOutputString.append(value);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::BeginString(size_t stringSize)
 	{
-		if (value.size() < 32u) {
-			mOutputString.push_back(static_cast<char>(static_cast<uint8_t>(value.size()) | 0b10100000u));
+		if (stringSize < 32u) {
+			mOutputString.push_back(static_cast<char>(static_cast<uint8_t>(stringSize) | 0b10100000u));
 		}
 		else
 		{
-			if (value.size() <= std::numeric_limits<uint8_t>::max()) {
-				PushValue(mOutputString, '\xD9', static_cast<uint8_t>(value.size()));
+			if (stringSize <= std::numeric_limits<uint8_t>::max()) {
+				PushValue(mOutputString, '\xD9', static_cast<uint8_t>(stringSize));
 			}
-			else if (value.size() <= std::numeric_limits<uint16_t>::max()) {
-				PushValue(mOutputString, '\xDA', static_cast<uint16_t>(value.size()));
+			else if (stringSize <= std::numeric_limits<uint16_t>::max()) {
+				PushValue(mOutputString, '\xDA', static_cast<uint16_t>(stringSize));
 			}
-			else if (value.size() <= std::numeric_limits<uint32_t>::max()) {
-				PushValue(mOutputString, '\xDB', static_cast<uint32_t>(value.size()));
+			else if (stringSize <= std::numeric_limits<uint32_t>::max()) {
+				PushValue(mOutputString, '\xDB', static_cast<uint32_t>(stringSize));
 			}
 			else {
 				throw SerializationException(SerializationErrorCode::OutOfRange, "String size is too large");
 			}
 		}
-		mOutputString.append(value);
 	}
 
-	void CMsgPackStringWriter::WriteValue(const CBinTimestamp& timestamp)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValue(const CBinTimestamp& timestamp)
 	{
 		if (static_cast<uint64_t>(timestamp.Seconds) >> 34u == 0u)
 		{
@@ -215,7 +413,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::BeginArray(size_t arraySize)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::BeginArray(size_t arraySize)
 	{
 		if (arraySize < 16u) {
 			mOutputString.push_back(static_cast<char>(static_cast<uint8_t>(arraySize) | 0b10010000u));
@@ -234,7 +433,8 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::BeginMap(size_t mapSize)
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::BeginMap(size_t mapSize)
 	{
 		if (mapSize < 16u) {
 			mOutputString.push_back(static_cast<char>(static_cast<uint8_t>(mapSize) | 0b10000000u));
@@ -253,7 +453,84 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
-	void CMsgPackStringWriter::BeginBinary(size_t binarySize)
+	template <typename TOutput>
+	size_t CMsgPackBasicStringWriter<TOutput>::BeginMapWithUnknownSize()
+	{
+		const size_t headerPos = mOutputString.size();
+		const bool isLargeMapExpected = mMapsDepth < max_predicted_maps_depth && (mLargeMapsMask >> mMapsDepth & 1u);
+		++mMapsDepth;
+
+		// Most of objects have less than 16 fields, so at first is written the header of "fixmap" (1 byte)
+		if (!isLargeMapExpected)
+		{
+			mOutputString.push_back('\x80');
+			return headerPos;
+		}
+		// The previous map on this level was large, so is reserved the header of "map16" (3 bytes)
+		constexpr char header[1 + sizeof(uint16_t)] = { '\xDE', '\x00', '\x00' };
+		mOutputString.append(header, sizeof(header));
+		return headerPos | map16_header_flag;
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::EndMapWithUnknownSize(size_t headerPos, size_t mapSize)
+	{
+		--mMapsDepth;
+		if (mMapsDepth < max_predicted_maps_depth)
+		{
+			const uint64_t levelBit = uint64_t(1) << mMapsDepth;
+			mLargeMapsMask = mapSize >= 16u ? (mLargeMapsMask | levelBit) : (mLargeMapsMask & ~levelBit);
+		}
+
+		// The header is resized only when its size was mispredicted (the output is the same as measured by `MeasureObject()`)
+		const size_t reservedSize = (headerPos & map16_header_flag) ? 1 + sizeof(uint16_t) : 1;
+		headerPos &= ~map16_header_flag;
+		if (mapSize < 16u)
+		{
+			const char header = static_cast<char>(static_cast<uint8_t>(mapSize) | 0b10000000u);
+			if (reservedSize == 1) {
+				SetByte(mOutputString, headerPos, header);
+			}
+			else {
+				mOutputString.replace(headerPos, reservedSize, &header, 1);
+			}
+		}
+		else if (mapSize <= std::numeric_limits<uint16_t>::max())
+		{
+			char header[1 + sizeof(uint16_t)];
+			EncodeValue(header, '\xDE', static_cast<uint16_t>(mapSize));
+			if (reservedSize == sizeof(header))
+			{
+				for (size_t i = 0; i < sizeof(header); ++i) {
+					SetByte(mOutputString, headerPos + i, header[i]);
+				}
+			}
+			else {
+				mOutputString.replace(headerPos, reservedSize, header, sizeof(header));
+			}
+		}
+		else if (mapSize <= std::numeric_limits<uint32_t>::max())
+		{
+			char header[1 + sizeof(uint32_t)];
+			EncodeValue(header, '\xDF', static_cast<uint32_t>(mapSize));
+			mOutputString.replace(headerPos, reservedSize, header, sizeof(header));
+		}
+		else {
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Map size is too large");
+		}
+	}
+
+	template <typename TOutput>
+	size_t CMsgPackBasicStringWriter<TOutput>::TakeMeasuredMapSize() noexcept
+	{
+		if (mMeasuredMapSizes && mMeasuredMapIndex < mMeasuredMapSizes->size()) {
+			return (*mMeasuredMapSizes)[mMeasuredMapIndex++];
+		}
+		return unknown_size;
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::BeginBinary(size_t binarySize)
 	{
 		if (binarySize <= std::numeric_limits<uint8_t>::max()) {
 			PushValue(mOutputString, '\xC4', static_cast<uint8_t>(binarySize));
@@ -269,221 +546,542 @@ namespace BitSerializer::MsgPack::Detail
 		}
 	}
 
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount)
+	{
+		const size_t itemSize = GetTypedArrayItemSize(itemType);
+		if (itemSize == 0) {
+			throw std::invalid_argument("Internal error: invalid type of items in typed array");
+		}
+		if (itemsCount > (std::numeric_limits<uint32_t>::max() - 1) / itemSize) {
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Typed array size is too large");
+		}
+
+		// The data of extension contains the type of items and the items themselves
+		const size_t dataSize = 1 + itemsCount * itemSize;
+		if (dataSize <= std::numeric_limits<uint8_t>::max()) {
+			PushValue(mOutputString, '\xC7', static_cast<uint8_t>(dataSize));
+		}
+		else if (dataSize <= std::numeric_limits<uint16_t>::max()) {
+			PushValue(mOutputString, '\xC8', static_cast<uint16_t>(dataSize));
+		}
+		else {
+			PushValue(mOutputString, '\xC9', static_cast<uint32_t>(dataSize));
+		}
+		mOutputString.push_back(typed_array_ext_type);
+		mOutputString.push_back(static_cast<char>(itemType));
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const uint8_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const uint16_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const uint32_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const uint64_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const int8_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const int16_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const int32_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const int64_t* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const float* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template <typename TOutput>
+	void CMsgPackBasicStringWriter<TOutput>::WriteValues(const double* values, size_t count)
+	{
+		PushValues(mOutputString, values, count);
+	}
+
+	template class CMsgPackBasicStringWriter<std::string>;
+	template class CMsgPackBasicStringWriter<FixedOutputBuffer>;
+	template class CMsgPackBasicStringWriter<COutputStringRef>;
+
 	//------------------------------------------------------------------------------
 
-	CMsgPackStreamWriter::CMsgPackStreamWriter(std::ostream& outputStream)
-		: mOutputStream(outputStream)
+	CMsgPackSizeWriter::CMsgPackSizeWriter(size_t& outputSize, const SerializationOptions&)
+		: mOutputSize(outputSize)
 	{ }
 
-	void CMsgPackStreamWriter::WriteValue(std::nullptr_t)
+	void CMsgPackSizeWriter::WriteValue(uint8_t value)
 	{
-		mOutputStream.put('\xC0');
+		mOutputSize += GetEncodedNumberSize(value);
 	}
 
-	void CMsgPackStreamWriter::WriteValue(bool value)
+	void CMsgPackSizeWriter::WriteValue(uint16_t value)
 	{
-		mOutputStream.put(value ? '\xC3' : '\xC2');
+		mOutputSize += GetEncodedNumberSize(value);
 	}
 
-	void CMsgPackStreamWriter::WriteValue(uint8_t value)
+	void CMsgPackSizeWriter::WriteValue(uint32_t value)
 	{
-		if (value >= 128u) {
-			mOutputStream.put('\xCC');
-		}
-		mOutputStream.put(static_cast<char>(value));
+		mOutputSize += GetEncodedNumberSize(value);
 	}
 
-	void CMsgPackStreamWriter::WriteValue(uint16_t value)
+	void CMsgPackSizeWriter::WriteValue(uint64_t value)
 	{
-		if (value > std::numeric_limits<uint8_t>::max()) {
-			PushValue(mOutputStream, '\xCD', value);
+		mOutputSize += GetEncodedNumberSize(value);
+	}
+
+	void CMsgPackSizeWriter::WriteValue(int8_t value)
+	{
+		mOutputSize += GetEncodedNumberSize(value);
+	}
+
+	void CMsgPackSizeWriter::WriteValue(int16_t value)
+	{
+		mOutputSize += GetEncodedNumberSize(value);
+	}
+
+	void CMsgPackSizeWriter::WriteValue(int32_t value)
+	{
+		mOutputSize += GetEncodedNumberSize(value);
+	}
+
+	void CMsgPackSizeWriter::WriteValue(int64_t value)
+	{
+		mOutputSize += GetEncodedNumberSize(value);
+	}
+
+	void CMsgPackSizeWriter::WriteValue(std::string_view value)
+	{
+		const size_t stringSize = value.size();
+		if (stringSize < 32u) {
+			mOutputSize += 1;
+		}
+		else if (stringSize <= std::numeric_limits<uint8_t>::max()) {
+			mOutputSize += 1 + sizeof(uint8_t);
+		}
+		else if (stringSize <= std::numeric_limits<uint16_t>::max()) {
+			mOutputSize += 1 + sizeof(uint16_t);
+		}
+		else if (stringSize <= std::numeric_limits<uint32_t>::max()) {
+			mOutputSize += 1 + sizeof(uint32_t);
 		}
 		else {
-			WriteValue(static_cast<uint8_t>(value));
+			throw SerializationException(SerializationErrorCode::OutOfRange, "String size is too large");
 		}
+		mOutputSize += stringSize;
 	}
 
-	void CMsgPackStreamWriter::WriteValue(uint32_t value)
+	void CMsgPackSizeWriter::WriteValue(const CBinTimestamp& timestamp)
 	{
-		if (value > std::numeric_limits<uint16_t>::max()) {
-			PushValue(mOutputStream, '\xCE', value);
+		if (static_cast<uint64_t>(timestamp.Seconds) >> 34u == 0u)
+		{
+			const uint64_t data64 = (static_cast<uint64_t>(timestamp.Nanoseconds) << 34u) | static_cast<uint64_t>(timestamp.Seconds);
+			// Code + extension type + data of timestamp 32 or timestamp 64
+			mOutputSize += 2 + ((data64 & 0xFFFFFFFF00000000ul) == 0u ? sizeof(uint32_t) : sizeof(uint64_t));
 		}
-		else {
-			WriteValue(static_cast<uint16_t>(value));
+		else
+		{
+			// Code + size + extension type + data of timestamp 96
+			mOutputSize += 3 + sizeof(timestamp.Seconds) + sizeof(timestamp.Nanoseconds);
 		}
 	}
 
-	void CMsgPackStreamWriter::WriteValue(uint64_t value)
+	void CMsgPackSizeWriter::BeginArray(size_t arraySize)
 	{
-		if (value > std::numeric_limits<uint32_t>::max()) {
-			PushValue(mOutputStream, '\xCF', value);
+		if (arraySize < 16u) {
+			mOutputSize += 1;
+		}
+		else if (arraySize <= std::numeric_limits<uint16_t>::max()) {
+			mOutputSize += 1 + sizeof(uint16_t);
+		}
+		else if (arraySize <= std::numeric_limits<uint32_t>::max()) {
+			mOutputSize += 1 + sizeof(uint32_t);
 		}
 		else {
-			WriteValue(static_cast<uint32_t>(value));
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Array size is too large");
 		}
 	}
 
-	void CMsgPackStreamWriter::WriteValue(int8_t value)
+	void CMsgPackSizeWriter::BeginMap(size_t mapSize)
 	{
-		if (value >= -32) {
-			mOutputStream.put(value);
+		if (mapSize < 16u) {
+			mOutputSize += 1;
+		}
+		else if (mapSize <= std::numeric_limits<uint16_t>::max()) {
+			mOutputSize += 1 + sizeof(uint16_t);
+		}
+		else if (mapSize <= std::numeric_limits<uint32_t>::max()) {
+			mOutputSize += 1 + sizeof(uint32_t);
 		}
 		else {
-			PushValue(mOutputStream, '\xD0', value);
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Map size is too large");
 		}
 	}
 
-	void CMsgPackStreamWriter::WriteValue(int16_t value)
+	size_t CMsgPackSizeWriter::BeginMapWithUnknownSize()
 	{
-		if (value < std::numeric_limits<int8_t>::min() || value > std::numeric_limits<int8_t>::max()) {
-			PushValue(mOutputStream, '\xD1', value);
+		++mOutputSize;
+		// The index of map in the list of measured sizes is returned instead of the position of header
+		if (mMeasuredMapSizes)
+		{
+			mMeasuredMapSizes->push_back(unknown_size);
+			return mMeasuredMapSizes->size() - 1;
 		}
-		else {
-			WriteValue(static_cast<int8_t>(value));
+		return 0;
+	}
+
+	void CMsgPackSizeWriter::EndMapWithUnknownSize(size_t headerPos, size_t mapSize)
+	{
+		if (mMeasuredMapSizes) {
+			(*mMeasuredMapSizes)[headerPos] = mapSize;
+		}
+		if (mapSize >= 16u) {
+			BeginMap(mapSize);
+			--mOutputSize;
 		}
 	}
 
-	void CMsgPackStreamWriter::WriteValue(int32_t value)
+	void CMsgPackSizeWriter::BeginBinary(size_t binarySize)
 	{
-		if (value < std::numeric_limits<int16_t>::min() || value > std::numeric_limits<int16_t>::max()) {
-			PushValue(mOutputStream, '\xD2', value);
+		if (binarySize <= std::numeric_limits<uint8_t>::max()) {
+			mOutputSize += 1 + sizeof(uint8_t);
+		}
+		else if (binarySize <= std::numeric_limits<uint16_t>::max()) {
+			mOutputSize += 1 + sizeof(uint16_t);
+		}
+		else if (binarySize <= std::numeric_limits<uint32_t>::max()) {
+			mOutputSize += 1 + sizeof(uint32_t);
 		}
 		else {
-			WriteValue(static_cast<int16_t>(value));
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Binary size is too large");
 		}
 	}
 
-	void CMsgPackStreamWriter::WriteValue(int64_t value)
+	void CMsgPackSizeWriter::BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount)
 	{
-		if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
-			PushValue(mOutputStream, '\xD3', value);
+		const size_t itemSize = GetTypedArrayItemSize(itemType);
+		if (itemSize == 0) {
+			throw std::invalid_argument("Internal error: invalid type of items in typed array");
+		}
+		if (itemsCount > (std::numeric_limits<uint32_t>::max() - 1) / itemSize) {
+			throw SerializationException(SerializationErrorCode::OutOfRange, "Typed array size is too large");
+		}
+
+		// Header of extension + extension type + type of items (the items are written separately)
+		const size_t dataSize = 1 + itemsCount * itemSize;
+		if (dataSize <= std::numeric_limits<uint8_t>::max()) {
+			mOutputSize += 1 + sizeof(uint8_t);
+		}
+		else if (dataSize <= std::numeric_limits<uint16_t>::max()) {
+			mOutputSize += 1 + sizeof(uint16_t);
 		}
 		else {
-			WriteValue(static_cast<int32_t>(value));
+			mOutputSize += 1 + sizeof(uint32_t);
 		}
+		mOutputSize += 2;
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const uint8_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const uint16_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const uint32_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const uint64_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const int8_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const int16_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const int32_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	void CMsgPackSizeWriter::WriteValues(const int64_t* values, size_t count)
+	{
+		mOutputSize += GetEncodedNumbersSize(values, count);
+	}
+
+	//------------------------------------------------------------------------------
+
+	CMsgPackStreamWriter::CMsgPackStreamWriter(std::ostream& outputStream, const SerializationOptions& serializationOptions)
+		: mOutputStream(outputStream)
+		, mBufferSize(serializationOptions.streamOptions.writeBufferSize)
+		, mBufferWriter(mBuffer, serializationOptions)
+	{
+		mBuffer.reserve(mBufferSize);
+	}
+
+	CMsgPackStreamWriter::~CMsgPackStreamWriter()
+	{
+		try
+		{
+			Flush();
+		}
+		catch (...)
+		{
+			// Ignore errors of writing to the stream in the destructor
+		}
+	}
+
+	void CMsgPackStreamWriter::WriteValue(std::nullptr_t)
+	{
+		mBufferWriter.WriteValue(nullptr);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(bool value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(uint8_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(uint16_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(uint32_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(uint64_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(int8_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(int16_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(int32_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteValue(int64_t value)
+	{
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
 	}
 
 	void CMsgPackStreamWriter::WriteValue(float value)
 	{
-		uint32_t buf;
-		std::memcpy(&buf, &value, sizeof(uint32_t));
-		PushValue(mOutputStream, '\xCA', buf);
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
 	}
 
 	void CMsgPackStreamWriter::WriteValue(double value)
 	{
-		uint64_t buf;
-		std::memcpy(&buf, &value, sizeof(uint64_t));
-		PushValue(mOutputStream, '\xCB', buf);
+		mBufferWriter.WriteValue(value);
+		FlushIfFull();
 	}
 
 	void CMsgPackStreamWriter::WriteValue(std::string_view value)
 	{
-		if (value.size() < 32u) {
-			mOutputStream.put(static_cast<char>(static_cast<uint8_t>(value.size()) | 0b10100000u));
-		}
-		else
+		if (mBuffer.size() + value.size() < mBufferSize)
 		{
-			if (value.size() <= std::numeric_limits<uint8_t>::max()) {
-				PushValue(mOutputStream, '\xD9', static_cast<uint8_t>(value.size()));
-			}
-			else if (value.size() <= std::numeric_limits<uint16_t>::max()) {
-				PushValue(mOutputStream, '\xDA', static_cast<uint16_t>(value.size()));
-			}
-			else if (value.size() <= std::numeric_limits<uint32_t>::max()) {
-				PushValue(mOutputStream, '\xDB', static_cast<uint32_t>(value.size()));
-			}
-			else {
-				throw SerializationException(SerializationErrorCode::OutOfRange, "String size is too large");
-			}
+			mBufferWriter.WriteValue(value);
+			FlushIfFull();
+			return;
 		}
+
+		// Large strings are written directly to the stream
+		mBufferWriter.BeginString(value.size());
+		Flush();
 		mOutputStream.write(value.data(), static_cast<std::streamsize>(value.size()));
 	}
 
 	void CMsgPackStreamWriter::WriteValue(const CBinTimestamp& timestamp)
 	{
-		if (static_cast<uint64_t>(timestamp.Seconds) >> 34u == 0u)
-		{
-			const uint64_t data64 = (static_cast<uint64_t>(timestamp.Nanoseconds) << 34u) | static_cast<uint64_t>(timestamp.Seconds);
-			if ((data64 & 0xFFFFFFFF00000000ul) == 0)
-			{
-				// timestamp 32
-				mOutputStream.put('\xD6');
-				PushValue(mOutputStream, -1, static_cast<uint32_t>(data64));
-			}
-			else
-			{
-				// timestamp 64
-				mOutputStream.put('\xD7');
-				PushValue(mOutputStream, -1, data64);
-			}
-		}
-		else
-		{
-			mOutputStream.put('\xC7');
-			mOutputStream.put(12);
-			// timestamp 96
-			PushValue(mOutputStream, -1, timestamp.Seconds);
-			PushValue(mOutputStream, timestamp.Nanoseconds);
-		}
+		mBufferWriter.WriteValue(timestamp);
+		FlushIfFull();
 	}
 
 	void CMsgPackStreamWriter::BeginArray(size_t arraySize)
 	{
-		if (arraySize < 16u) {
-			mOutputStream.put(static_cast<char>(static_cast<uint8_t>(arraySize) | 0b10010000u));
-		}
-		else
-		{
-			if (arraySize <= std::numeric_limits<uint16_t>::max()) {
-				PushValue(mOutputStream, '\xDC', static_cast<uint16_t>(arraySize));
-			}
-			else if (arraySize <= std::numeric_limits<uint32_t>::max()) {
-				PushValue(mOutputStream, '\xDD', static_cast<uint32_t>(arraySize));
-			}
-			else {
-				throw SerializationException(SerializationErrorCode::OutOfRange, "Array size is too large");
-			}
-		}
+		mBufferWriter.BeginArray(arraySize);
+		FlushIfFull();
 	}
 
 	void CMsgPackStreamWriter::BeginMap(size_t mapSize)
 	{
-		if (mapSize < 16u) {
-			mOutputStream.put(static_cast<char>(static_cast<uint8_t>(mapSize) | 0b10000000u));
-		}
-		else
-		{
-			if (mapSize <= std::numeric_limits<uint16_t>::max()) {
-				PushValue(mOutputStream, '\xDE', static_cast<uint16_t>(mapSize));
-			}
-			else if (mapSize <= std::numeric_limits<uint32_t>::max()) {
-				PushValue(mOutputStream, '\xDF', static_cast<uint32_t>(mapSize));
-			}
-			else {
-				throw SerializationException(SerializationErrorCode::OutOfRange, "Map size is too large");
-			}
-		}
+		mBufferWriter.BeginMap(mapSize);
+		FlushIfFull();
 	}
 
 	void CMsgPackStreamWriter::BeginBinary(size_t binarySize)
 	{
-		if (binarySize <= std::numeric_limits<uint8_t>::max()) {
-			PushValue(mOutputStream, '\xC4', static_cast<uint8_t>(binarySize));
-		}
-		else if (binarySize <= std::numeric_limits<uint16_t>::max()) {
-			PushValue(mOutputStream, '\xC5', static_cast<uint16_t>(binarySize));
-		}
-		else if (binarySize <= std::numeric_limits<uint32_t>::max()) {
-			PushValue(mOutputStream, '\xC6', static_cast<uint32_t>(binarySize));
+		mBufferWriter.BeginBinary(binarySize);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::BeginTypedArray(TypedArrayItemType itemType, size_t itemsCount)
+	{
+		mBufferWriter.BeginTypedArray(itemType, itemsCount);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteBinary(char byte)
+	{
+		mBuffer.push_back(byte);
+		FlushIfFull();
+	}
+
+	void CMsgPackStreamWriter::WriteBinary(const char* data, size_t size)
+	{
+		if (mBuffer.size() + size < mBufferSize)
+		{
+			mBuffer.append(data, size);
+			return;
 		}
-		else {
-			throw SerializationException(SerializationErrorCode::OutOfRange, "Binary size is too large");
+
+		// Large blocks are written directly to the stream
+		Flush();
+		mOutputStream.write(data, static_cast<std::streamsize>(size));
+	}
+
+	template <typename T>
+	void CMsgPackStreamWriter::WriteValuesImpl(const T* values, size_t count)
+	{
+		// Numbers are encoded by chunks which fit into the staging buffer
+		const size_t chunkSize = (std::max)(mBufferSize / (1 + sizeof(T)), static_cast<size_t>(1));
+		while (count != 0)
+		{
+			const size_t itemsToWrite = (std::min)(count, chunkSize);
+			mBufferWriter.WriteValues(values, itemsToWrite);
+			values += itemsToWrite;
+			count -= itemsToWrite;
+			FlushIfFull();
 		}
 	}
 
-	void CMsgPackStreamWriter::WriteBinary(char byte)
+	void CMsgPackStreamWriter::WriteValues(const uint8_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const uint16_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const uint32_t* values, size_t count)
 	{
-		mOutputStream.put(byte);
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const uint64_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const int8_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const int16_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const int32_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const int64_t* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const float* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::WriteValues(const double* values, size_t count)
+	{
+		WriteValuesImpl(values, count);
+	}
+
+	void CMsgPackStreamWriter::Flush()
+	{
+		if (!mBuffer.empty())
+		{
+			mOutputStream.write(mBuffer.data(), static_cast<std::streamsize>(mBuffer.size()));
+			mBuffer.clear();
+		}
 	}
 }
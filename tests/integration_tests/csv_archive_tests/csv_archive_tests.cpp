@@ -149,6 +149,59 @@ TEST_F(CsvArchiveTests, SerializeArrayOfClassesToStream)
 	TestSerializeArrayToStream<CsvArchive>(testArray);
 }
 
+TEST_F(CsvArchiveTests, SaveArrayOfClassesToFixedBuffer)
+{
+	// Arrange
+	TestClassWithSubTypes<int, double, std::string> testArray[3];
+	BuildFixture(testArray);
+	std::get<2>(testArray[1]) = "value with \"quotes\", separator";
+	const std::string expected = BitSerializer::SaveObject<CsvArchive>(testArray);
+	char buffer[1024];
+
+	// Act
+	const size_t actualSize = BitSerializer::SaveObject<CsvArchive>(testArray, buffer, sizeof(buffer));
+
+	// Assert
+	EXPECT_EQ(expected, std::string(buffer, actualSize));
+}
+
+TEST_F(CsvArchiveTests, ShouldReturnRequiredSizeWhenFixedBufferIsOverflowed)
+{
+	// Arrange
+	TestClassWithSubTypes<int, std::string> testArray[3];
+	BuildFixture(testArray);
+	const std::string expected = BitSerializer::SaveObject<CsvArchive>(testArray);
+	std::string buffer(expected.size() - 1, '\0');
+
+	// Act
+	FixedOutputBuffer output(buffer.data(), buffer.size());
+	BitSerializer::SaveObject<CsvArchive>(testArray, output);
+
+	// Assert
+	EXPECT_TRUE(output.overflowed());
+	EXPECT_EQ(expected.size(), output.size());
+}
+
+// PMR containers on Apple is supported since C++ 20
+#if defined(__cpp_lib_memory_resource) && (!defined __apple_build_version__ || ((defined(_MSVC_LANG) && _MSVC_LANG >= 202002L) || __cplusplus >= 202002L))
+TEST_F(CsvArchiveTests, SaveArrayOfClassesToPmrString)
+{
+	// Arrange
+	TestClassWithSubTypes<int, double, std::string> testArray[3];
+	BuildFixture(testArray);
+	const std::string expected = BitSerializer::SaveObject<CsvArchive>(testArray);
+	char arena[16 * 1024];
+	std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+	std::pmr::string actual(&resource);
+
+	// Act
+	BitSerializer::SaveObject<CsvArchive>(testArray, actual);
+
+	// Assert
+	EXPECT_EQ(expected, std::string_view(actual));
+}
+#endif
+
 TEST_F(CsvArchiveTests, SerializeUnicodeToEncodedStream) {
 	TestClassWithSubType<std::wstring> TestArray[1] = { TestClassWithSubType<std::wstring>(L"Привет мир!") };
 	TestSerializeArrayToStream<CsvArchive>(TestArray);
@@ -228,6 +281,26 @@ TEST_F(CsvArchiveTests, SerializeToFile) {
 	TestSerializeArrayToFile<CsvArchive>(true);
 }
 
+TEST_F(CsvArchiveTests, SerializeToFileInUtf16)
+{
+	// Arrange
+	const auto testFilePath = std::filesystem::temp_directory_path() / "TestArchiveUtf16.csv";
+	TestPointClass testArray[3], actual[3];
+	BuildFixture(testArray);
+	SerializationOptions serializationOptions;
+	serializationOptions.streamOptions.encoding = Convert::Utf::UtfType::Utf16le;
+
+	// Act
+	BitSerializer::SaveObjectToFile<CsvArchive>(testArray, testFilePath, serializationOptions, true);
+	BitSerializer::LoadObjectFromFile<CsvArchive>(actual, testFilePath);
+
+	// Assert
+	for (size_t i = 0; i < std::size(testArray); i++)
+	{
+		testArray[i].Assert(actual[i]);
+	}
+}
+
 TEST_F(CsvArchiveTests, SerializeToFileThrowExceptionWhenAlreadyExists) {
 	TestThrowExceptionWhenFileAlreadyExists<CsvArchive>();
 }
@@ -15,6 +15,7 @@
 #include "bitserializer/types/std/tuple.h"
 #include "bitserializer/types/std/memory.h"
 #include "bitserializer/types/std/filesystem.h"
+#include "bitserializer/types/std/map.h"
 
 using namespace BitSerializer;
 using BitSerializer::MsgPack::MsgPackArchive;
@@ -372,6 +373,36 @@ TEST(MsgPackArchive, SerializeClassInReverseOrderWithSubObject)
 	TestSerializeType<MsgPackArchive>(fixture);
 }
 
+TEST(MsgPackArchive, SerializeWideClassInReverseOrder)
+{
+	// Wide objects are loaded via index of keys
+	using TestType = TestClassWithReverseLoad<int, bool, float, std::string, int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t,
+		int64_t, uint64_t, double, std::string, TestPointClass, std::array<uint64_t, 5>, bool, int, std::string, float>;
+	TestSerializeType<MsgPackArchive>(BuildFixture<TestType>());
+	TestSerializeClassToStream<MsgPackArchive>(BuildFixture<TestType>());
+}
+
+TEST(MsgPackArchive, ShouldSkipUnknownFieldsWhenLoadWideClassInReverseOrder)
+{
+	using SourceType = TestClassWithSubTypes<int, int, int, int, int, int, int, int, int, int,
+		int, int, int, int, int, int, int, int, int, int, std::string, TestPointClass>;
+	using TargetType = TestClassWithReverseLoad<int, int, int, int, int, int, int, int, int, int,
+		int, int, int, int, int, int, int, int, int, int>;
+	SourceType sourceArray[2];
+	BuildFixture(sourceArray);
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(sourceArray);
+
+	TargetType targetArray[2];
+	BitSerializer::LoadObject<MsgPackArchive>(targetArray, data);
+
+	for (size_t i = 0; i < 2; ++i)
+	{
+		EXPECT_EQ(std::get<0>(sourceArray[i]), std::get<0>(targetArray[i]));
+		EXPECT_EQ(std::get<10>(sourceArray[i]), std::get<10>(targetArray[i]));
+		EXPECT_EQ(std::get<19>(sourceArray[i]), std::get<19>(targetArray[i]));
+	}
+}
+
 TEST(MsgPackArchive, SerializeClassWithSkippingFields)
 {
 	TestClassWithVersioning arrayOfObjects[3];
@@ -409,6 +440,97 @@ TEST(MsgPackArchive, SerializeClassWithTimestampAsKey)
 	TestSerializeType<MsgPackArchive>(BuildFixture<TestClassWithCustomKey<Detail::CBinTimestamp>>());
 }
 
+namespace
+{
+	struct TestClassWithKeysOfDifferentSize
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			static constexpr char shortKeyInBuffer[16] = "abc";
+			archive << KeyValue("x", X);
+			archive << KeyValue(shortKeyInBuffer, Y);
+			archive << KeyValue("key_with_length_of_31_character", Z);
+			archive << KeyValue("key_with_length_of_32_characters", W);
+		}
+
+		int X = 1, Y = 2, Z = 3, W = 4;
+	};
+}
+
+TEST(MsgPackArchive, ShouldSaveStringLiteralKeysAsMsgPackStrings)
+{
+	const std::string expected = std::string({ '\x84', '\xA1', 'x', '\x01', '\xA3', 'a', 'b', 'c', '\x02', '\xBF' })
+		+ "key_with_length_of_31_character" + '\x03' + std::string({ '\xD9', '\x20' }) + "key_with_length_of_32_characters" + '\x04';
+	EXPECT_EQ(expected, BitSerializer::SaveObject<MsgPackArchive>(TestClassWithKeysOfDifferentSize()));
+
+	std::stringstream stream;
+	BitSerializer::SaveObject<MsgPackArchive>(TestClassWithKeysOfDifferentSize(), stream);
+	EXPECT_EQ(expected, stream.str());
+}
+
+namespace
+{
+	template <bool WithFieldIds>
+	struct TestClassWithFieldIds
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			if constexpr (WithFieldIds)
+			{
+				archive << KeyValue("identifier", Id, FieldId(1), Required());
+				archive << KeyValue("description", Text, FieldId(2));
+			}
+			else
+			{
+				archive << KeyValue("identifier", Id);
+				archive << KeyValue("description", Text);
+			}
+		}
+
+		int Id = 0;
+		std::string Text;
+	};
+}
+
+TEST(MsgPackArchive, ShouldSaveFieldIdsInsteadOfNames)
+{
+	const TestClassWithFieldIds<true> testObj{ 5, "a" };
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	EXPECT_EQ(std::string({ '\x82', '\x01', '\x05', '\x02', '\xA1', 'a' }), data);
+}
+
+TEST(MsgPackArchive, SerializeClassWithFieldIds)
+{
+	const TestClassWithFieldIds<true> testObj{ 100, "test" };
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+
+	TestClassWithFieldIds<true> actual;
+	BitSerializer::LoadObject<MsgPackArchive>(actual, data);
+	EXPECT_EQ(testObj.Id, actual.Id);
+	EXPECT_EQ(testObj.Text, actual.Text);
+}
+
+TEST(MsgPackArchive, ShouldLoadFieldsByNamesWhenSavedWithoutIds)
+{
+	const TestClassWithFieldIds<false> testObj{ 100, "test" };
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+
+	TestClassWithFieldIds<true> actual;
+	BitSerializer::LoadObject<MsgPackArchive>(actual, data);
+	EXPECT_EQ(testObj.Id, actual.Id);
+	EXPECT_EQ(testObj.Text, actual.Text);
+}
+
+TEST(MsgPackArchive, ThrowValidationExceptionWhenMissedRequiredValueWithFieldId)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(std::map<int, std::string>{ { 2, "test" } });
+	TestClassWithFieldIds<true> actual;
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(actual, data), ValidationException);
+	EXPECT_EQ("test", actual.Text);
+}
+
 //-----------------------------------------------------------------------------
 // Test paths in archive
 //-----------------------------------------------------------------------------
@@ -445,6 +567,124 @@ TEST(MsgPackArchive, SerializeToFileThrowExceptionWhenAlreadyExists) {
 	TestThrowExceptionWhenFileAlreadyExists<MsgPackArchive>();
 }
 
+TEST(MsgPackArchive, ShouldSaveSameDataToStringAndStream)
+{
+	// Objects saved to string are written in single pass (with patching the size of map)
+	using TestType = TestClassWithSubTypes<int, TestClassWithSubArray<TestPointClass>, TestClassWithSubTypes<std::string, TestPointClass>,
+		int, int, int, int, int, int, int, int, int, int, int, int, int, int, std::string>;
+	TestType testObj[2];
+	BuildFixture(testObj);
+
+	const auto outputString = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, outputStream);
+
+	EXPECT_EQ(outputStream.str(), outputString);
+}
+
+TEST(MsgPackArchive, ShouldSaveToStreamWithDifferentSizesOfWriteBuffer)
+{
+	using TestType = TestClassWithSubTypes<int, std::string, TestClassWithSubTypes<std::string, TestPointClass>, double, std::string>;
+	TestType testObj[10];
+	BuildFixture(testObj);
+	const auto expected = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+
+	for (const size_t writeBufferSize : { 0, 1, 7, 64, 64 * 1024 })
+	{
+		SerializationOptions serializationOptions;
+		serializationOptions.streamOptions.writeBufferSize = writeBufferSize;
+		std::stringstream outputStream;
+		BitSerializer::SaveObject<MsgPackArchive>(testObj, outputStream, serializationOptions);
+		EXPECT_EQ(expected, outputStream.str()) << "Size of write buffer: " << writeBufferSize;
+	}
+}
+
+TEST(MsgPackArchive, ShouldLoadFromStreamWithDifferentSizesOfReadBuffer)
+{
+	using TestType = TestClassWithSubTypes<int, std::string, TestClassWithSubTypes<std::string, TestPointClass>, double, std::string>;
+	TestType testObj[10];
+	BuildFixture(testObj);
+	// Add a string which does not fit into the minimal read buffer
+	std::get<1>(testObj[5]) = std::string(1000, 'x');
+	const auto sourceData = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+
+	for (const bool growReadBuffer : { false, true })
+	{
+		for (const size_t readBufferSize : { 0, 64, 256, 8 * 1024 })
+		{
+			SerializationOptions serializationOptions;
+			serializationOptions.streamOptions.readBufferSize = readBufferSize;
+			serializationOptions.streamOptions.growReadBuffer = growReadBuffer;
+			std::stringstream inputStream(sourceData);
+			TestType actual[10];
+			BitSerializer::LoadObject<MsgPackArchive>(actual, inputStream, serializationOptions);
+			for (size_t i = 0; i < std::size(testObj); ++i) {
+				testObj[i].Assert(actual[i]);
+			}
+		}
+	}
+}
+
+TEST(MsgPackArchive, ThrowExceptionWhenSizeOfStringExceedsInputStream)
+{
+	for (const bool growReadBuffer : { false, true })
+	{
+		SerializationOptions serializationOptions;
+		serializationOptions.streamOptions.growReadBuffer = growReadBuffer;
+		std::stringstream inputStream(std::string("\xDB\xFF\xFF\xFF\xF0") + std::string(20000, 'x'));
+		std::string actual;
+		EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(actual, inputStream, serializationOptions), ParsingException);
+	}
+}
+
+TEST(MsgPackArchive, ShouldLoadFromSegmentedInputWithDifferentSizesOfSegments)
+{
+	using TestType = TestClassWithSubTypes<int, std::string, TestClassWithSubTypes<std::string, TestPointClass>, double, std::string>;
+	TestType testObj[10];
+	BuildFixture(testObj);
+	// Add a string which straddles the boundaries of several segments
+	std::get<1>(testObj[5]) = std::string(1000, 'x');
+	const auto sourceData = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	const std::string_view sourceDataView(sourceData);
+
+	for (const size_t segmentSize : { 1, 7, 256, 64 * 1024 })
+	{
+		std::vector<std::string_view> segments;
+		for (size_t pos = 0; pos < sourceDataView.size(); pos += segmentSize) {
+			segments.emplace_back(sourceDataView.substr(pos, segmentSize));
+		}
+
+		TestType actual[10];
+		BitSerializer::LoadObject<MsgPackArchive>(actual, SegmentedInput(segments));
+		for (size_t i = 0; i < std::size(testObj); ++i) {
+			testObj[i].Assert(actual[i]);
+		}
+	}
+}
+
+TEST(MsgPackArchive, ShouldThrowExceptionWhenSegmentedInputIsIncomplete)
+{
+	const auto sourceData = BitSerializer::SaveObject<MsgPackArchive>(BuildFixture<TestClassWithSubTypes<std::string, int64_t>>());
+	const std::string_view segments[] = { std::string_view(sourceData).substr(0, 2), std::string_view(sourceData).substr(2, sourceData.size() - 3) };
+
+	TestClassWithSubTypes<std::string, int64_t> actual;
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(actual, SegmentedInput(segments)), ParsingException);
+}
+
+TEST(MsgPackArchive, ShouldSelectRootScopeBoundToConcreteReaderAndWriter)
+{
+	using namespace BitSerializer::MsgPack::Detail;
+	static_assert(std::is_same_v<select_input_archive_t<MsgPackArchive, std::string>, CMsgPackReadRootScope<CMsgPackStringReader>>);
+	static_assert(std::is_same_v<select_input_archive_t<MsgPackArchive, std::istream>, CMsgPackReadRootScope<CMsgPackStreamReader>>);
+	static_assert(std::is_same_v<select_input_archive_t<MsgPackArchive, SegmentedInput>, CMsgPackReadRootScope<CMsgPackSegmentedReader>>);
+	static_assert(std::is_same_v<select_output_archive_t<MsgPackArchive, std::string>, CMsgPackWriteRootScope<CMsgPackStringWriter>>);
+	static_assert(std::is_same_v<select_output_archive_t<MsgPackArchive, std::ostream>, CMsgPackWriteRootScope<CMsgPackStreamWriter>>);
+
+	// Archives without specific bindings should use common root scopes
+	static_assert(std::is_same_v<select_input_archive_t<TArchiveBase<MsgPackArchiveTraits, int, long>, std::string>, int>);
+	static_assert(std::is_same_v<select_output_archive_t<TArchiveBase<MsgPackArchiveTraits, int, long>, std::string>, long>);
+}
+
 //-----------------------------------------------------------------------------
 // Tests of errors handling
 //-----------------------------------------------------------------------------
@@ -523,6 +763,91 @@ TEST(MsgPackArchive, ThrowExceptionWhenNoMoreValuesToRead)
 	}
 }
 
+TEST(MsgPackArchive, ThrowExceptionWhenSizeOfBinaryArrayExceedsInputData)
+{
+	const std::string testMsgPack("\xC6\xFF\xFF\xFF\xF0\x01\x02", 7);
+	std::vector<uint8_t> actual;
+	try
+	{
+		BitSerializer::LoadObject<MsgPackArchive>(actual, testMsgPack);
+		EXPECT_FALSE(true);
+	}
+	catch (const ParsingException& ex)
+	{
+		EXPECT_EQ(5U, ex.Offset);
+	}
+}
+
+TEST(MsgPackArchive, ThrowExceptionWhenSizeOfBinaryArrayExceedsInputStream)
+{
+	std::stringstream inputStream(std::string("\xC6\xFF\xFF\xFF\xF0\x01\x02", 7));
+	std::vector<uint8_t> actual;
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(actual, inputStream), ParsingException);
+}
+
+TEST(MsgPackArchive, ShouldLoadLargeBinaryArrayFromStream)
+{
+	std::vector<uint8_t> expected(300000);
+	for (size_t i = 0; i < expected.size(); ++i) {
+		expected[i] = static_cast<uint8_t>(i * 31);
+	}
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(expected, outputStream);
+
+	std::vector<uint8_t> actual;
+	outputStream.seekg(0);
+	BitSerializer::LoadObject<MsgPackArchive>(actual, outputStream);
+	EXPECT_EQ(expected, actual);
+}
+
+namespace
+{
+	template <size_t FieldsCount>
+	struct TestClassWithWrongFixedFields
+	{
+		BITSERIALIZER_FIXED_FIELDS(FieldsCount);
+
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("x", x) << KeyValue("y", y);
+		}
+
+		int x = 1;
+		int y = 2;
+	};
+}
+
+TEST(MsgPackArchive, ThrowExceptionWhenWrittenLessFieldsThanFixedSize)
+{
+	TestClassWithWrongFixedFields<3> testObj;
+	std::string outputData;
+	try
+	{
+		BitSerializer::SaveObject<MsgPackArchive>(testObj, outputData);
+		EXPECT_FALSE(true);
+	}
+	catch (const SerializationException& ex)
+	{
+		EXPECT_EQ(SerializationErrorCode::OutOfRange, ex.GetErrorCode());
+	}
+}
+
+TEST(MsgPackArchive, ThrowExceptionWhenWrittenMoreFieldsThanFixedSize)
+{
+	TestClassWithWrongFixedFields<1> testObj;
+	std::string outputData;
+	try
+	{
+		BitSerializer::SaveObject<MsgPackArchive>(testObj, outputData);
+		EXPECT_FALSE(true);
+	}
+	catch (const SerializationException& ex)
+	{
+		EXPECT_EQ(SerializationErrorCode::OutOfRange, ex.GetErrorCode());
+	}
+}
+
 //-----------------------------------------------------------------------------
 TEST(MsgPackArchive, ThrowValidationExceptionWhenMissedRequiredValue) {
 	TestValidationForNamedValues<MsgPackArchive, TestClassForCheckValidation<bool>>();
@@ -725,3 +1050,208 @@ TEST(MsgPackArchive, SerializeStdTypes)
 	TestSerializeType<MsgPackArchive, std::chrono::system_clock::time_point>();
 	TestSerializeType<MsgPackArchive, std::chrono::seconds>();
 }
+
+//-----------------------------------------------------------------------------
+// Tests of measuring the size of data
+//-----------------------------------------------------------------------------
+namespace
+{
+	template <typename T>
+	void TestMeasureObject(const T& value, const SerializationOptions& options = DefaultOptions)
+	{
+		std::string expected;
+		BitSerializer::SaveObject<MsgPackArchive>(value, expected, options);
+		EXPECT_EQ(expected.size(), BitSerializer::MeasureObject<MsgPackArchive>(value, options));
+	}
+
+	/// Object with variable number of fields (is saved as map with unknown size).
+	struct TestObjectWithVariableFields
+	{
+		explicit TestObjectWithVariableFields(size_t fieldsCount = 0)
+		{
+			for (size_t i = 0; i < fieldsCount; ++i) {
+				Fields.emplace_back("f" + Convert::ToString(i), static_cast<int>(i));
+			}
+		}
+
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			for (auto& [key, value] : Fields) {
+				archive << KeyValue(key, value);
+			}
+		}
+
+		std::vector<std::pair<std::string, int>> Fields;
+	};
+}
+
+TEST(MsgPackArchive, ShouldMeasureSameSizeAsSavedData)
+{
+	TestMeasureObject(BuildFixture<TestClassWithSubTypes<int8_t, uint8_t, int64_t, uint64_t, float, double, bool>>());
+	TestMeasureObject(BuildFixture<TestClassWithSubTypes<std::string, std::wstring, std::u16string, std::nullptr_t>>());
+	TestMeasureObject(BuildFixture<TestClassWithSubTypes<TestClassWithSubTypes<int64_t>>>());
+	TestMeasureObject(BuildFixture<TestClassWithCustomKey<Detail::CBinTimestamp>>());
+	TestMeasureObject(std::map<std::string, std::vector<int>>{ { "a", { 1, -100, 70000 } }, { std::string(40, 'k'), std::vector<int>(20, 300) } });
+	TestMeasureObject(std::vector<std::string>(100, std::string(300, 'x')));
+	TestMeasureObject(std::make_unique<std::string>("test"));
+}
+
+TEST(MsgPackArchive, ShouldMeasureTypedArrays)
+{
+	SerializationOptions options;
+	options.useTypedArrays = true;
+	TestMeasureObject(std::vector<int32_t>(1000, -70000), options);
+	TestMeasureObject(TestClassWithSubTypes(std::vector<double>(100, 1.5), std::vector<uint16_t>(10, 300)), options);
+}
+
+TEST(MsgPackArchive, ShouldReserveExactSizeWhenEnabledInOptions)
+{
+	// Arrange
+	std::vector<TestClassWithSubTypes<int64_t, std::string>> testObj(100);
+	for (auto& item : testObj) {
+		BuildFixture(item);
+	}
+	SerializationOptions options;
+	options.reserveExactSize = true;
+
+	// Act
+	std::string actual;
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, actual, options);
+
+	// Assert
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(testObj), actual);
+	EXPECT_EQ(BitSerializer::MeasureObject<MsgPackArchive>(testObj), actual.capacity());
+}
+
+TEST(MsgPackArchive, ShouldWriteSmallestHeadersOfMapsWithUnknownSize)
+{
+	// Arrange
+	std::vector<TestObjectWithVariableFields> testObj;
+	for (const size_t fieldsCount : { 20, 3, 20, 20, 17, 1, 70000, 16, 0 }) {
+		testObj.emplace_back(fieldsCount);
+	}
+	std::string expected(1, static_cast<char>(0x90 | testObj.size()));
+	for (const auto& item : testObj) {
+		expected += BitSerializer::SaveObject<MsgPackArchive>(item);
+	}
+	SerializationOptions options;
+	options.reserveExactSize = true;
+
+	// Act
+	const std::string actual = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	std::string actualWithExactSize;
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, actualWithExactSize, options);
+
+	// Assert
+	EXPECT_EQ(expected, actual);
+	EXPECT_EQ(expected, actualWithExactSize);
+	EXPECT_EQ(expected.size(), BitSerializer::MeasureObject<MsgPackArchive>(testObj));
+}
+
+//-----------------------------------------------------------------------------
+// Tests of saving to the fixed buffer
+//-----------------------------------------------------------------------------
+TEST(MsgPackArchive, SaveObjectToFixedBuffer)
+{
+	// Arrange
+	auto testObj = BuildFixture<TestClassWithSubTypes<int64_t, double, std::string, std::vector<int32_t>, std::map<std::string, int>>>();
+	const std::string expected = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	char buffer[4096];
+
+	// Act
+	const size_t actualSize = BitSerializer::SaveObject<MsgPackArchive>(testObj, buffer, sizeof(buffer));
+
+	// Assert
+	ASSERT_LE(actualSize, sizeof(buffer));
+	EXPECT_EQ(expected, std::string(buffer, actualSize));
+}
+
+TEST(MsgPackArchive, SaveWideObjectToFixedBuffer)
+{
+	// Arrange (the header of map is expanded when it has 16 or more items)
+	std::map<std::string, std::vector<uint16_t>> testObj;
+	for (int i = 0; i < 20; ++i) {
+		testObj.emplace(Convert::ToString(i), std::vector<uint16_t>(20, static_cast<uint16_t>(i * 1000)));
+	}
+	const std::string expected = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	std::vector<char> buffer(expected.size());
+
+	// Act
+	const size_t actualSize = BitSerializer::SaveObject<MsgPackArchive>(testObj, buffer.data(), buffer.size());
+
+	// Assert
+	EXPECT_EQ(expected, std::string(buffer.data(), actualSize));
+}
+
+TEST(MsgPackArchive, ShouldReturnRequiredSizeWhenFixedBufferIsOverflowed)
+{
+	// Arrange
+	auto testObj = BuildFixture<TestClassWithSubTypes<std::string, std::vector<int32_t>, TestClassWithSubTypes<int64_t>>>();
+	const std::string expected = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	std::string buffer(expected.size() / 2, '\0');
+
+	// Act
+	FixedOutputBuffer output(buffer.data(), buffer.size());
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, output);
+
+	// Assert
+	EXPECT_TRUE(output.overflowed());
+	EXPECT_TRUE(output.view().empty());
+	EXPECT_EQ(expected.size(), output.size());
+}
+
+//-----------------------------------------------------------------------------
+// Tests of saving to strings with custom allocators
+//-----------------------------------------------------------------------------
+// PMR containers on Apple is supported since C++ 20
+#if defined(__cpp_lib_memory_resource) && (!defined __apple_build_version__ || ((defined(_MSVC_LANG) && _MSVC_LANG >= 202002L) || __cplusplus >= 202002L))
+TEST(MsgPackArchive, SaveObjectToPmrString)
+{
+	// Arrange
+	auto testObj = BuildFixture<TestClassWithSubTypes<int64_t, std::string, std::vector<int32_t>, std::map<std::string, int>>>();
+	const std::string expected = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	char arena[16 * 1024];
+	std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+	std::pmr::string actual(&resource);
+
+	// Act
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, actual);
+
+	// Assert
+	EXPECT_EQ(expected, std::string_view(actual));
+}
+
+TEST(MsgPackArchive, SaveObjectToPmrStringWithReservingExactSize)
+{
+	// Arrange
+	auto testObj = BuildFixture<TestClassWithSubTypes<int64_t, std::string, std::vector<int32_t>>>();
+	const std::string expected = BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	SerializationOptions options;
+	options.reserveExactSize = true;
+	std::pmr::string actual;
+
+	// Act
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, actual, options);
+
+	// Assert
+	EXPECT_EQ(expected, std::string_view(actual));
+}
+
+TEST(MsgPackArchive, SaveLargeObjectToPmrStringWithExistingData)
+{
+	// Arrange
+	std::vector<TestClassWithSubTypes<int64_t, std::string>> testObj(1000);
+	for (auto& item : testObj) {
+		BuildFixture(item);
+	}
+	const std::string expected = "prefix" + BitSerializer::SaveObject<MsgPackArchive>(testObj);
+	std::pmr::string actual("prefix");
+
+	// Act
+	BitSerializer::SaveObject<MsgPackArchive>(testObj, actual);
+
+	// Assert
+	EXPECT_EQ(expected, std::string_view(actual));
+}
+#endif
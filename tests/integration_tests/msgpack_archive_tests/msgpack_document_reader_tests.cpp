@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include <sstream>
+#include <gtest/gtest.h>
+#include "bitserializer/msgpack_document_reader.h"
+#include "bitserializer/types/std/vector.h"
+#include "testing_tools/common_test_entities.h"
+
+using namespace BitSerializer;
+using BitSerializer::MsgPack::MsgPackArchive;
+using BitSerializer::MsgPack::MsgPackStreamDocumentReader;
+
+namespace
+{
+	struct TestEvent
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("id", Id);
+			archive << KeyValue("name", Name);
+			archive << KeyValue("values", Values);
+		}
+
+		bool operator==(const TestEvent& rhs) const {
+			return Id == rhs.Id && Name == rhs.Name && Values == rhs.Values;
+		}
+
+		uint32_t Id = 0;
+		std::string Name;
+		std::vector<int> Values;
+	};
+
+	std::vector<TestEvent> BuildTestEvents(uint32_t count)
+	{
+		std::vector<TestEvent> events;
+		for (uint32_t i = 0; i < count; ++i) {
+			events.push_back({ i, "event" + Convert::ToString(i), std::vector<int>(i % 10, static_cast<int>(i)) });
+		}
+		return events;
+	}
+
+	std::stringstream SaveDocuments(const std::vector<TestEvent>& events)
+	{
+		std::stringstream stream;
+		for (const auto& event : events) {
+			BitSerializer::SaveObject<MsgPackArchive>(event, stream);
+		}
+		return stream;
+	}
+}
+
+
+TEST(MsgPackStreamDocumentReader, ShouldReadAllDocumentsFromStream)
+{
+	// Arrange
+	const auto expected = BuildTestEvents(100);
+	auto stream = SaveDocuments(expected);
+
+	// Act
+	MsgPackStreamDocumentReader reader(stream);
+	std::vector<TestEvent> actual;
+	for (TestEvent event; reader.ReadNext(event);) {
+		actual.push_back(std::move(event));
+	}
+
+	// Assert
+	EXPECT_EQ(expected, actual);
+	EXPECT_FALSE(reader.ReadNext(TestEvent()));
+}
+
+TEST(MsgPackStreamDocumentReader, ShouldReadDocumentsWhichCrossBoundariesOfReadBuffer)
+{
+	// Arrange
+	const auto expected = BuildTestEvents(50);
+	auto stream = SaveDocuments(expected);
+	SerializationOptions options;
+	options.streamOptions.readBufferSize = 16;
+
+	// Act
+	MsgPackStreamDocumentReader reader(stream, options);
+	std::vector<TestEvent> actual;
+	for (TestEvent event; reader.ReadNext(event);) {
+		actual.push_back(std::move(event));
+	}
+
+	// Assert
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackStreamDocumentReader, ShouldReadDocumentsOfDifferentTypes)
+{
+	// Arrange
+	std::stringstream stream;
+	BitSerializer::SaveObject<MsgPackArchive>(std::string("header"), stream);
+	BitSerializer::SaveObject<MsgPackArchive>(TestPointClass(10, 20), stream);
+	BitSerializer::SaveObject<MsgPackArchive>(std::vector<int>{ 1, 2, 3 }, stream);
+
+	// Act
+	MsgPackStreamDocumentReader reader(stream);
+	std::string header;
+	ASSERT_TRUE(reader.ReadNext(header));
+	TestPointClass point;
+	ASSERT_TRUE(reader.ReadNext(point));
+	std::vector<int> values;
+	ASSERT_TRUE(reader.ReadNext(values));
+
+	// Assert
+	EXPECT_EQ("header", header);
+	EXPECT_EQ(TestPointClass(10, 20), point);
+	EXPECT_EQ(std::vector<int>({ 1, 2, 3 }), values);
+	EXPECT_FALSE(reader.ReadNext(values));
+}
+
+TEST(MsgPackStreamDocumentReader, ShouldReturnFalseWhenStreamIsEmpty)
+{
+	std::stringstream stream;
+	MsgPackStreamDocumentReader reader(stream);
+	TestEvent event;
+	EXPECT_FALSE(reader.ReadNext(event));
+}
+
+TEST(MsgPackStreamDocumentReader, ShouldThrowExceptionWhenLastDocumentIsTruncated)
+{
+	// Arrange
+	const auto events = BuildTestEvents(2);
+	const auto data = SaveDocuments(events).str();
+	std::stringstream stream(data.substr(0, data.size() - 2));
+
+	// Act / Assert
+	MsgPackStreamDocumentReader reader(stream);
+	TestEvent event;
+	ASSERT_TRUE(reader.ReadNext(event));
+	EXPECT_EQ(events[0], event);
+	EXPECT_THROW(reader.ReadNext(event), ParsingException);
+}
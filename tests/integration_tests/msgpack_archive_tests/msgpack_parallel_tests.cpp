@@ -0,0 +1,283 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include <sstream>
+#include <gtest/gtest.h>
+#include "bitserializer/msgpack_parallel.h"
+#include "testing_tools/common_test_entities.h"
+
+using namespace BitSerializer;
+using BitSerializer::MsgPack::MsgPackArchive;
+using BitSerializer::MsgPack::LoadArrayInParallel;
+using BitSerializer::MsgPack::SaveArrayInParallel;
+
+namespace
+{
+	struct TestRecord
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("id", Id);
+			archive << KeyValue("name", Name);
+			archive << KeyValue("values", Values);
+		}
+
+		bool operator==(const TestRecord& rhs) const {
+			return Id == rhs.Id && Name == rhs.Name && Values == rhs.Values;
+		}
+
+		uint32_t Id = 0;
+		std::string Name;
+		std::vector<int> Values;
+	};
+
+	std::vector<TestRecord> BuildTestRecords(uint32_t count)
+	{
+		std::vector<TestRecord> records;
+		records.reserve(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			records.push_back({ i, "record" + Convert::ToString(i), std::vector<int>(i % 7, static_cast<int>(i)) });
+		}
+		return records;
+	}
+
+	struct TestRecordWithError
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			if (Id == ErrorId) {
+				throw SerializationException(SerializationErrorCode::OutOfRange, "Test error");
+			}
+			archive << KeyValue("id", Id);
+		}
+
+		static constexpr uint32_t ErrorId = 1500;
+		uint32_t Id = 0;
+	};
+
+	struct TestRecordWithLoadError
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("id", Id);
+			// Each of slices has failed item
+			if (Id % 500 == 499) {
+				throw SerializationException(SerializationErrorCode::OutOfRange, "Failed item: " + Convert::ToString(Id));
+			}
+		}
+
+		uint32_t Id = 0;
+	};
+}
+
+
+TEST(MsgPackLoadArrayInParallel, ShouldLoadLargeArrayOfObjects)
+{
+	// Arrange
+	const auto expected = BuildTestRecords(10000);
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(expected);
+
+	// Act
+	std::vector<TestRecord> actual;
+	LoadArrayInParallel(actual, data, DefaultOptions, 4);
+
+	// Assert
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldLoadSmallArrayInCurrentThread)
+{
+	const auto expected = BuildTestRecords(10);
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(expected);
+
+	std::vector<TestRecord> actual;
+	LoadArrayInParallel(actual, data);
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldLoadArrayOfNumbers)
+{
+	std::vector<int64_t> expected(5000);
+	for (size_t i = 0; i < expected.size(); ++i) {
+		expected[i] = static_cast<int64_t>(i * i) - 1000;
+	}
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(expected);
+
+	std::vector<int64_t> actual;
+	LoadArrayInParallel(actual, data, DefaultOptions, 3);
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldLoadVectorOfBoolInCurrentThread)
+{
+	std::vector<bool> expected(5000);
+	for (size_t i = 0; i < expected.size(); ++i) {
+		expected[i] = i % 3 == 0;
+	}
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(expected);
+
+	std::vector<bool> actual;
+	LoadArrayInParallel(actual, data, DefaultOptions, 3);
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldMergeValidationErrorsOfAllItems)
+{
+	// Arrange
+	std::vector<TestClassForCheckValidation<int>> source(1000);
+	for (auto& item : source) {
+		BuildFixture(item);
+	}
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(source);
+
+	// Act / Assert
+	std::vector<TestClassForCheckValidation<int>> target;
+	try
+	{
+		LoadArrayInParallel(target, data, DefaultOptions, 4);
+		FAIL() << "ValidationException is expected";
+	}
+	catch (ValidationException& ex)
+	{
+		const auto& validationErrors = ex.GetValidationErrors();
+		EXPECT_EQ(source.size(), validationErrors.size());
+		EXPECT_EQ(1U, validationErrors.count("/0/NotExistingField"));
+		EXPECT_EQ(1U, validationErrors.count("/999/NotExistingField"));
+	}
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldThrowExceptionWhenItemHasMismatchedType)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(BuildTestRecords(2000));
+	std::vector<int> target;
+	EXPECT_THROW(LoadArrayInParallel(target, data, DefaultOptions, 4), SerializationException);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldThrowParsingExceptionWhenArrayIsTruncated)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(BuildTestRecords(2000));
+	std::vector<TestRecord> target;
+	EXPECT_THROW(LoadArrayInParallel(target, std::string_view(data).substr(0, data.size() - 3), DefaultOptions, 4), ParsingException);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldThrowParsingExceptionWhenSizeOfArrayExceedsInputData)
+{
+	const std::string data("\xDD\xFF\xFF\xFF\xFF", 5);
+	std::vector<TestRecord> target;
+	EXPECT_THROW(LoadArrayInParallel(target, data, DefaultOptions, 4), ParsingException);
+}
+
+TEST(MsgPackLoadArrayInParallel, ShouldThrowFirstErrorInOrderOfItems)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(BuildTestRecords(2000));
+	std::vector<TestRecordWithLoadError> target;
+	try
+	{
+		LoadArrayInParallel(target, data, DefaultOptions, 4);
+		FAIL() << "Expected SerializationException";
+	}
+	catch (const SerializationException& ex)
+	{
+		EXPECT_STREQ("Out of range: Failed item: 499", ex.what());
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+TEST(MsgPackSaveArrayInParallel, ShouldSaveLargeArrayOfObjectsSameAsSaveObject)
+{
+	// Arrange
+	const auto records = BuildTestRecords(10000);
+	const auto expected = BitSerializer::SaveObject<MsgPackArchive>(records);
+
+	// Act
+	std::string actual;
+	SaveArrayInParallel(records, actual, DefaultOptions, 4);
+
+	// Assert
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldSaveSameDataWithDifferentChunkSizes)
+{
+	const auto records = BuildTestRecords(3001);
+	const auto expected = BitSerializer::SaveObject<MsgPackArchive>(records);
+
+	for (const size_t chunkSize : { 1, 7, 256, 1000, 3001, 5000 })
+	{
+		std::string actual;
+		SaveArrayInParallel(records, actual, DefaultOptions, 3, chunkSize);
+		EXPECT_EQ(expected, actual) << "Chunk size: " << chunkSize;
+	}
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldSaveToStream)
+{
+	const auto records = BuildTestRecords(5000);
+	const auto expected = BitSerializer::SaveObject<MsgPackArchive>(records);
+
+	std::ostringstream outputStream;
+	SaveArrayInParallel(records, outputStream, DefaultOptions, 4, 100);
+	EXPECT_EQ(expected, outputStream.str());
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldApplySerializationOptionsToItems)
+{
+	const auto records = BuildTestRecords(2000);
+	SerializationOptions options;
+	options.useTypedArrays = true;
+	std::string expected;
+	BitSerializer::SaveObject<MsgPackArchive>(records, expected, options);
+
+	std::string actual;
+	SaveArrayInParallel(records, actual, options, 4);
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldSaveSmallArrayAndArrayOfNumbersInCurrentThread)
+{
+	const auto records = BuildTestRecords(10);
+	std::string actualRecords;
+	SaveArrayInParallel(records, actualRecords);
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(records), actualRecords);
+
+	const std::vector<int64_t> numbers(5000, -100);
+	std::string actualNumbers;
+	SaveArrayInParallel(numbers, actualNumbers, DefaultOptions, 4);
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(numbers), actualNumbers);
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldAppendToExistingString)
+{
+	const auto records = BuildTestRecords(2000);
+	std::string actual = "prefix";
+	SaveArrayInParallel(records, actual, DefaultOptions, 2);
+	EXPECT_EQ("prefix" + BitSerializer::SaveObject<MsgPackArchive>(records), actual);
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldSaveAndLoadBackInParallel)
+{
+	const auto expected = BuildTestRecords(4000);
+	std::string data;
+	SaveArrayInParallel(expected, data, DefaultOptions, 4);
+
+	std::vector<TestRecord> actual;
+	LoadArrayInParallel(actual, data, DefaultOptions, 4);
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackSaveArrayInParallel, ShouldRethrowExceptionFromItem)
+{
+	std::vector<TestRecordWithError> records(3000);
+	for (uint32_t i = 0; i < records.size(); ++i) {
+		records[i].Id = i;
+	}
+
+	std::string output;
+	EXPECT_THROW(SaveArrayInParallel(records, output, DefaultOptions, 4), SerializationException);
+	EXPECT_TRUE(output.empty());
+}
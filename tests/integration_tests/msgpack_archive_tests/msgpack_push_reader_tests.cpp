@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include <gtest/gtest.h>
+#include "bitserializer/msgpack_push_reader.h"
+#include "bitserializer/types/std/map.h"
+#include "bitserializer/types/std/vector.h"
+#include "testing_tools/common_test_entities.h"
+
+using namespace BitSerializer;
+using BitSerializer::MsgPack::MsgPackArchive;
+using BitSerializer::MsgPack::MsgPackFeedResult;
+using BitSerializer::MsgPack::MsgPackPushReader;
+
+namespace
+{
+	struct TestMessage
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("id", Id);
+			archive << KeyValue("text", Text);
+			archive << KeyValue("values", Values);
+			archive << KeyValue("attributes", Attributes);
+		}
+
+		bool operator==(const TestMessage& rhs) const {
+			return Id == rhs.Id && Text == rhs.Text && Values == rhs.Values && Attributes == rhs.Attributes;
+		}
+
+		uint32_t Id = 0;
+		std::string Text;
+		std::vector<double> Values;
+		std::map<std::string, int> Attributes;
+	};
+
+	std::vector<TestMessage> BuildTestMessages(uint32_t count)
+	{
+		std::vector<TestMessage> messages;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			messages.push_back({ i, std::string(i * 20, 'x'), std::vector<double>(i % 5, i * 0.5),
+				{ { "a", static_cast<int>(i) }, { "b", -static_cast<int>(i) } } });
+		}
+		return messages;
+	}
+
+	std::string SaveMessages(const std::vector<TestMessage>& messages)
+	{
+		std::string data;
+		for (const auto& message : messages) {
+			data += BitSerializer::SaveObject<MsgPackArchive>(message);
+		}
+		return data;
+	}
+
+	std::vector<TestMessage> FeedByChunks(MsgPackPushReader& reader, std::string_view data, size_t chunkSize)
+	{
+		std::vector<TestMessage> messages;
+		for (size_t pos = 0; pos < data.size(); pos += chunkSize)
+		{
+			if (reader.Feed(data.substr(pos, chunkSize)) == MsgPackFeedResult::ValueReady)
+			{
+				for (TestMessage message; reader.ReadNext(message);) {
+					messages.push_back(std::move(message));
+				}
+			}
+		}
+		return messages;
+	}
+}
+
+
+TEST(MsgPackPushReader, ShouldReadValuesWhenDataIsFedByOneByte)
+{
+	// Arrange
+	const auto expected = BuildTestMessages(20);
+	const auto data = SaveMessages(expected);
+	MsgPackPushReader reader;
+
+	// Act
+	const auto actual = FeedByChunks(reader, data, 1);
+
+	// Assert
+	EXPECT_EQ(expected, actual);
+	EXPECT_EQ(0U, reader.GetBufferedSize());
+}
+
+TEST(MsgPackPushReader, ShouldReadValuesWhenDataIsFedByChunksOfDifferentSize)
+{
+	const auto expected = BuildTestMessages(50);
+	const auto data = SaveMessages(expected);
+	for (const size_t chunkSize : { 3, 7, 64, 1000, 100000 })
+	{
+		MsgPackPushReader reader;
+		EXPECT_EQ(expected, FeedByChunks(reader, data, chunkSize));
+		EXPECT_EQ(0U, reader.GetBufferedSize());
+	}
+}
+
+TEST(MsgPackPushReader, ShouldReturnNeedMoreDataUntilValueIsComplete)
+{
+	// Arrange
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(TestPointClass(1, 2));
+	MsgPackPushReader reader;
+	TestPointClass actual;
+
+	// Act / Assert
+	EXPECT_EQ(MsgPackFeedResult::NeedMoreData, reader.Feed(std::string_view(data).substr(0, data.size() - 1)));
+	EXPECT_FALSE(reader.ReadNext(actual));
+	EXPECT_EQ(data.size() - 1, reader.GetBufferedSize());
+
+	EXPECT_EQ(MsgPackFeedResult::ValueReady, reader.Feed(std::string_view(data).substr(data.size() - 1)));
+	ASSERT_TRUE(reader.ReadNext(actual));
+	EXPECT_EQ(TestPointClass(1, 2), actual);
+	EXPECT_FALSE(reader.ReadNext(actual));
+}
+
+TEST(MsgPackPushReader, ShouldReadValuesOfDifferentTypes)
+{
+	// Arrange
+	MsgPackPushReader reader;
+	reader.Feed(BitSerializer::SaveObject<MsgPackArchive>(std::string("header")));
+	reader.Feed(BitSerializer::SaveObject<MsgPackArchive>(std::vector<int>{ 1, 2, 3 }));
+
+	// Act
+	std::string header;
+	std::vector<int> values;
+	ASSERT_TRUE(reader.ReadNext(header));
+	ASSERT_TRUE(reader.ReadNext(values));
+
+	// Assert
+	EXPECT_EQ("header", header);
+	EXPECT_EQ(std::vector<int>({ 1, 2, 3 }), values);
+}
+
+TEST(MsgPackPushReader, ShouldContinueReadingAfterFailedValue)
+{
+	// Arrange
+	MsgPackPushReader reader;
+	reader.Feed(BitSerializer::SaveObject<MsgPackArchive>(std::string("text")));
+	reader.Feed(BitSerializer::SaveObject<MsgPackArchive>(TestPointClass(3, 4)));
+
+	// Act / Assert
+	TestPointClass actual;
+	EXPECT_THROW(reader.ReadNext(actual), SerializationException);
+	ASSERT_TRUE(reader.ReadNext(actual));
+	EXPECT_EQ(TestPointClass(3, 4), actual);
+}
+
+TEST(MsgPackPushReader, ShouldDropBufferedDataWhenReset)
+{
+	// Arrange
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(TestPointClass(5, 6));
+	MsgPackPushReader reader;
+	reader.Feed(std::string_view(data).substr(0, 3));
+
+	// Act
+	reader.Reset();
+	reader.Feed(data);
+
+	// Assert
+	TestPointClass actual;
+	ASSERT_TRUE(reader.ReadNext(actual));
+	EXPECT_EQ(TestPointClass(5, 6), actual);
+}
+
+TEST(MsgPackPushReader, ShouldThrowExceptionWhenDeclaredSizeExceedsMaxMessageSize)
+{
+	// Arrange
+	MsgPackPushReader reader(DefaultOptions, 1024);
+
+	// Act / Assert (header of string with size 4096)
+	EXPECT_THROW(reader.Feed(std::string_view("\xDA\x10\x00", 3)), ParsingException);
+	EXPECT_EQ(0U, reader.GetBufferedSize());
+}
+
+TEST(MsgPackPushReader, ShouldThrowExceptionWhenNumberOfItemsExceedsMaxMessageSize)
+{
+	// Arrange
+	MsgPackPushReader reader(DefaultOptions, 1024);
+
+	// Act / Assert (header of array with 65535 items)
+	EXPECT_THROW(reader.Feed(std::string_view("\xDC\xFF\xFF", 3)), ParsingException);
+}
+
+TEST(MsgPackPushReader, ShouldReadMessagesWithSizeEqualToMaxMessageSize)
+{
+	// Arrange
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(std::string(1000, 'x'));
+	MsgPackPushReader reader(DefaultOptions, data.size());
+
+	// Act
+	reader.Feed(data + data);
+
+	// Assert
+	std::string actual;
+	ASSERT_TRUE(reader.ReadNext(actual));
+	ASSERT_TRUE(reader.ReadNext(actual));
+	EXPECT_EQ(std::string(1000, 'x'), actual);
+	EXPECT_THROW(reader.Feed(BitSerializer::SaveObject<MsgPackArchive>(std::string(1001, 'x'))), ParsingException);
+}
@@ -19,6 +19,7 @@
 #include "bitserializer/types/std/map.h"
 #include "bitserializer/types/std/unordered_map.h"
 #include "bitserializer/types/std/valarray.h"
+#include "bitserializer/types/std/tuple.h"
 
 using namespace BitSerializer;
 using BitSerializer::MsgPack::MsgPackArchive;
@@ -72,9 +73,290 @@ TEST(MsgPackArchive, SerializeMapWithStringAsKey) {
 	TestSerializeType<MsgPackArchive, std::map<std::wstring, std::string>>();
 }
 
+//-----------------------------------------------------------------------------
+// Test serialization of binary containers
+//-----------------------------------------------------------------------------
+TEST(MsgPackArchive, SerializeBinaryContainers)
+{
+	TestSerializeType<MsgPackArchive, std::vector<char>>();
+	TestSerializeType<MsgPackArchive, std::vector<uint8_t>>();
+	TestSerializeType<MsgPackArchive, std::vector<std::byte>>();
+	TestSerializeType<MsgPackArchive, std::array<unsigned char, 7>>();
+	TestSerializeType<MsgPackArchive, std::array<std::byte, 7>>();
+	TestSerializeType<MsgPackArchive, std::deque<char>>();
+}
+
+TEST(MsgPackArchive, ShouldSaveBinaryContainersAsBinaryArray)
+{
+	const std::string expected = { '\xC4', '\x03', '\x01', '\x02', '\x03' };
+	EXPECT_EQ(expected, BitSerializer::SaveObject<MsgPackArchive>(std::vector<uint8_t>{ 1, 2, 3 }));
+	EXPECT_EQ(expected, BitSerializer::SaveObject<MsgPackArchive>(std::array<std::byte, 3>{ std::byte{1}, std::byte{2}, std::byte{3} }));
+	EXPECT_EQ(expected, BitSerializer::SaveObject<MsgPackArchive>(std::deque<char>{ 1, 2, 3 }));
+
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(std::vector<char>{ 1, 2, 3 }, outputStream);
+	EXPECT_EQ(expected, outputStream.str());
+}
+
+TEST(MsgPackArchive, SerializeLargeBinaryContainer)
+{
+	std::vector<uint8_t> expected(100000);
+	for (size_t i = 0; i < expected.size(); ++i) {
+		expected[i] = static_cast<uint8_t>(i * 7);
+	}
+
+	std::vector<uint8_t> actual1;
+	BitSerializer::LoadObject<MsgPackArchive>(actual1, BitSerializer::SaveObject<MsgPackArchive>(expected));
+	EXPECT_EQ(expected, actual1);
+
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(expected, outputStream);
+	outputStream.seekg(0);
+	std::vector<uint8_t> actual2{ 1, 2, 3 };
+	BitSerializer::LoadObject<MsgPackArchive>(actual2, outputStream);
+	EXPECT_EQ(expected, actual2);
+}
+
+TEST(MsgPackArchive, ShouldThrowExceptionWhenLoadBinaryArrayToStdArrayWithDifferentSize)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(std::vector<uint8_t>{ 1, 2, 3 });
+
+	std::array<uint8_t, 2> smallerArray{};
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(smallerArray, data), BitSerializer::SerializationException);
+	std::array<uint8_t, 4> largerArray{};
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(largerArray, data), BitSerializer::SerializationException);
+}
+
+TEST(MsgPackArchive, ShouldLoadBytesSavedAsRegularArrayToStdArray)
+{
+	// Arrange (the format of previous versions, where `std::array` of bytes was saved as regular array)
+	const std::string data = { '\x94', '\x01', '\x02', '\x03', '\x04' };
+	const std::array<uint8_t, 4> expected{ 1, 2, 3, 4 };
+	const std::array<std::byte, 4> expectedBytes{ std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4} };
+
+	// Act / Assert
+	std::array<uint8_t, 4> actual1{};
+	BitSerializer::LoadObject<MsgPackArchive>(actual1, data);
+	EXPECT_EQ(expected, actual1);
+
+	std::array<std::byte, 4> actual2{};
+	BitSerializer::LoadObject<MsgPackArchive>(actual2, data);
+	EXPECT_EQ(expectedBytes, actual2);
+
+	std::stringstream inputStream1(data);
+	std::array<uint8_t, 4> actual3{};
+	BitSerializer::LoadObject<MsgPackArchive>(actual3, inputStream1);
+	EXPECT_EQ(expected, actual3);
+
+	std::stringstream inputStream2(data);
+	std::array<std::byte, 4> actual4{};
+	BitSerializer::LoadObject<MsgPackArchive>(actual4, inputStream2);
+	EXPECT_EQ(expectedBytes, actual4);
+}
+
+TEST(MsgPackArchive, ShouldLoadBytesSavedAsRegularArrayToStdArrayWithKey)
+{
+	// Arrange
+	const std::string data = { '\x81', '\xA1', 'a', '\x94', '\x01', '\x02', '\x03', '\x04' };
+	const std::map<std::string, std::array<std::byte, 4>> expected{ { "a", { std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4} } } };
+
+	// Act / Assert
+	std::map<std::string, std::array<std::byte, 4>> actual1;
+	BitSerializer::LoadObject<MsgPackArchive>(actual1, data);
+	EXPECT_EQ(expected, actual1);
+
+	std::stringstream inputStream(data);
+	std::map<std::string, std::array<std::byte, 4>> actual2;
+	BitSerializer::LoadObject<MsgPackArchive>(actual2, inputStream);
+	EXPECT_EQ(expected, actual2);
+}
+
 //-----------------------------------------------------------------------------
 // Smoke tests of STD container serialization (more detailed tests in "unit_tests/std_types_tests")
 //-----------------------------------------------------------------------------
+TEST(MsgPackArchive, SerializeLargeArraysOfNumbers)
+{
+	std::vector<float> floats(10000);
+	std::vector<double> doubles(10000);
+	std::vector<int32_t> integers(10000);
+	std::vector<uint64_t> unsignedIntegers(10000);
+	for (size_t i = 0; i < floats.size(); ++i)
+	{
+		floats[i] = static_cast<float>(i) * 0.5f - 100.0f;
+		doubles[i] = static_cast<double>(i) * -0.25;
+		integers[i] = static_cast<int32_t>(i * i) - 1000;
+		unsignedIntegers[i] = static_cast<uint64_t>(i) << (i % 64);
+	}
+
+	TestSerializeType<MsgPackArchive>(floats);
+	TestSerializeType<MsgPackArchive>(doubles);
+	TestSerializeType<MsgPackArchive>(integers);
+	TestSerializeType<MsgPackArchive>(unsignedIntegers);
+
+	// Save to stream with the staging buffer less than array
+	SerializationOptions serializationOptions;
+	serializationOptions.streamOptions.writeBufferSize = 100;
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(doubles, outputStream, serializationOptions);
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(doubles), outputStream.str());
+	std::vector<double> actual{ 1.0, 2.0 };
+	BitSerializer::LoadObject<MsgPackArchive>(actual, outputStream);
+	EXPECT_EQ(doubles, actual);
+}
+
+TEST(MsgPackArchive, ShouldSaveArraysOfNumbersInSameFormatAsSingleValues)
+{
+	const std::vector<int64_t> integers = { 0, 1, -1, -32, -33, 127, 128, -128, -129, 255, 256, 32767, 32768, -32768, -32769,
+		65535, 65536, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(),
+		std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() };
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(std::list<int64_t>(integers.cbegin(), integers.cend())),
+		BitSerializer::SaveObject<MsgPackArchive>(integers));
+
+	const std::vector<uint32_t> unsignedIntegers = { 0, 127, 128, 255, 256, 65535, 65536, std::numeric_limits<uint32_t>::max() };
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(std::list<uint32_t>(unsignedIntegers.cbegin(), unsignedIntegers.cend())),
+		BitSerializer::SaveObject<MsgPackArchive>(unsignedIntegers));
+
+	const std::array<float, 3> floats = { 0.0f, -1.5f, std::numeric_limits<float>::max() };
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(std::list<float>(floats.cbegin(), floats.cend())),
+		BitSerializer::SaveObject<MsgPackArchive>(floats));
+}
+
+TEST(MsgPackArchive, ShouldLoadArrayOfNumbersStoredInDifferentFormats)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(std::make_tuple(1.5f, 2.5, 3, 4.5f, -5));
+	const std::vector<double> expected = { 1.5, 2.5, 3.0, 4.5, -5.0 };
+
+	std::vector<double> actual;
+	SerializationOptions serializationOptions;
+	serializationOptions.mismatchedTypesPolicy = MismatchedTypesPolicy::Skip;
+	BitSerializer::LoadObject<MsgPackArchive>(actual, data, serializationOptions);
+
+	// Integers can't be loaded to floating point types
+	ASSERT_EQ(expected.size(), actual.size());
+	EXPECT_EQ(1.5, actual[0]);
+	EXPECT_EQ(2.5, actual[1]);
+	EXPECT_EQ(0.0, actual[2]);
+	EXPECT_EQ(4.5, actual[3]);
+	EXPECT_EQ(0.0, actual[4]);
+}
+
+TEST(MsgPackArchive, ShouldThrowExceptionWhenLoadArrayOfNumbersToCArrayWithDifferentSize)
+{
+	const auto data = BitSerializer::SaveObject<MsgPackArchive>(std::vector<float>{ 1.0f, 2.0f, 3.0f });
+
+	float smallerArray[2]{};
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(smallerArray, data), BitSerializer::SerializationException);
+	float largerArray[4]{};
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(largerArray, data), BitSerializer::SerializationException);
+}
+
+TEST(MsgPackArchive, SerializeArraysOfNumbersAsTypedArrays)
+{
+	std::vector<float> floats(10000);
+	std::vector<int16_t> integers(100);
+	for (size_t i = 0; i < floats.size(); ++i) {
+		floats[i] = static_cast<float>(i) * 0.5f - 100.0f;
+	}
+	for (size_t i = 0; i < integers.size(); ++i) {
+		integers[i] = static_cast<int16_t>(i * i) - 1000;
+	}
+	SerializationOptions serializationOptions;
+	serializationOptions.useTypedArrays = true;
+
+	// Save to string
+	std::string floatsData;
+	BitSerializer::SaveObject<MsgPackArchive>(floats, floatsData, serializationOptions);
+	EXPECT_EQ(5 + floats.size() * sizeof(float), floatsData.size());
+	std::vector<float> actualFloats;
+	BitSerializer::LoadObject<MsgPackArchive>(actualFloats, floatsData);
+	EXPECT_EQ(floats, actualFloats);
+
+	std::string integersData;
+	BitSerializer::SaveObject<MsgPackArchive>(integers, integersData, serializationOptions);
+	EXPECT_EQ(4 + integers.size() * sizeof(int16_t), integersData.size());
+	std::array<int16_t, 100> actualIntegers{};
+	BitSerializer::LoadObject<MsgPackArchive>(actualIntegers, integersData);
+	EXPECT_TRUE(std::equal(integers.cbegin(), integers.cend(), actualIntegers.cbegin()));
+
+	// Save to stream with the staging buffer less than array
+	serializationOptions.streamOptions.writeBufferSize = 100;
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(floats, outputStream, serializationOptions);
+	EXPECT_EQ(floatsData, outputStream.str());
+	actualFloats.clear();
+	BitSerializer::LoadObject<MsgPackArchive>(actualFloats, outputStream);
+	EXPECT_EQ(floats, actualFloats);
+}
+
+TEST(MsgPackArchive, SerializeNestedArraysOfNumbersAsTypedArrays)
+{
+	const std::map<std::string, std::vector<std::vector<double>>> expected = {
+		{ "empty", {} },
+		{ "values", { { 1.5, -2.5 }, {}, { 3.0 } } }
+	};
+	SerializationOptions serializationOptions;
+	serializationOptions.useTypedArrays = true;
+
+	std::string data;
+	BitSerializer::SaveObject<MsgPackArchive>(expected, data, serializationOptions);
+	std::map<std::string, std::vector<std::vector<double>>> actual;
+	BitSerializer::LoadObject<MsgPackArchive>(actual, data);
+	EXPECT_EQ(expected, actual);
+
+	std::stringstream outputStream;
+	BitSerializer::SaveObject<MsgPackArchive>(expected, outputStream, serializationOptions);
+	EXPECT_EQ(data, outputStream.str());
+	actual.clear();
+	BitSerializer::LoadObject<MsgPackArchive>(actual, outputStream);
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(MsgPackArchive, ShouldSaveNonContiguousContainersAsRegularArraysWhenTypedArraysAreEnabled)
+{
+	const std::list<int32_t> values = { 1, 2, 3 };
+	SerializationOptions serializationOptions;
+	serializationOptions.useTypedArrays = true;
+	std::string data;
+	BitSerializer::SaveObject<MsgPackArchive>(values, data, serializationOptions);
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(values), data);
+}
+
+TEST(MsgPackArchive, ShouldLoadTypedArrayToContainerOfDifferentType)
+{
+	SerializationOptions serializationOptions;
+	serializationOptions.useTypedArrays = true;
+	std::string data;
+	BitSerializer::SaveObject<MsgPackArchive>(std::vector<int32_t>{ 1, -2, 300 }, data, serializationOptions);
+
+	std::list<int64_t> actualList;
+	BitSerializer::LoadObject<MsgPackArchive>(actualList, data);
+	EXPECT_EQ(std::list<int64_t>({ 1, -2, 300 }), actualList);
+
+	std::vector<int64_t> actualVector;
+	BitSerializer::LoadObject<MsgPackArchive>(actualVector, data);
+	EXPECT_EQ(std::vector<int64_t>({ 1, -2, 300 }), actualVector);
+
+	std::vector<int8_t> smallIntegers;
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(smallIntegers, data), BitSerializer::SerializationException);
+}
+
+TEST(MsgPackArchive, ShouldThrowExceptionWhenLoadTypedArrayToArrayOfStrings)
+{
+	SerializationOptions serializationOptions;
+	serializationOptions.useTypedArrays = true;
+	std::string data;
+	BitSerializer::SaveObject<MsgPackArchive>(std::vector<float>{ 1.0f, 2.0f }, data, serializationOptions);
+
+	std::vector<std::string> actual;
+	EXPECT_THROW(BitSerializer::LoadObject<MsgPackArchive>(actual, data), BitSerializer::SerializationException);
+
+	// Items should be skipped when policy is `Skip`
+	serializationOptions.mismatchedTypesPolicy = MismatchedTypesPolicy::Skip;
+	std::vector<std::vector<float>> actualArrays;
+	BitSerializer::LoadObject<MsgPackArchive>(actualArrays, data, serializationOptions);
+	EXPECT_EQ(2U, actualArrays.size());
+}
+
 TEST(MsgPackArchive, SerializeStdContainers)
 {
 	TestSerializeType<MsgPackArchive, std::array<int, 7>>();
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include <gtest/gtest.h>
+#include "bitserializer/msgpack_view.h"
+#include "bitserializer/types/std/map.h"
+#include "bitserializer/types/std/vector.h"
+
+using namespace BitSerializer;
+using BitSerializer::MsgPack::MsgPackArchive;
+using BitSerializer::MsgPack::MsgPackView;
+
+namespace
+{
+	struct TestOrder
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("id", Id);
+			archive << KeyValue("price", Price);
+			archive << KeyValue("tags", Tags);
+		}
+
+		bool operator==(const TestOrder& rhs) const {
+			return Id == rhs.Id && Price == rhs.Price && Tags == rhs.Tags;
+		}
+
+		uint32_t Id = 0;
+		double Price = 0;
+		std::vector<std::string> Tags;
+	};
+
+	struct TestMessage
+	{
+		template <class TArchive>
+		void Serialize(TArchive& archive)
+		{
+			archive << KeyValue("source", Source);
+			archive << KeyValue("orders", Orders);
+			archive << KeyValue("attributes", Attributes);
+		}
+
+		std::string Source;
+		std::vector<TestOrder> Orders;
+		std::map<std::string, int> Attributes;
+	};
+
+	class MsgPackViewTest : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			mMessage.Source = "exchange";
+			for (uint32_t i = 0; i < 20; ++i) {
+				mMessage.Orders.push_back({ i, 100.0 + i, { "tag" + Convert::ToString(i) } });
+			}
+			mMessage.Attributes = { { "a", 1 }, { "b", 2 } };
+			mData = BitSerializer::SaveObject<MsgPackArchive>(mMessage);
+		}
+
+		TestMessage mMessage;
+		std::string mData;
+	};
+}
+
+
+TEST_F(MsgPackViewTest, ShouldGetValueByKeysAndIndexes)
+{
+	const MsgPackView view(mData);
+	EXPECT_EQ("exchange", view["source"].As<std::string>());
+	EXPECT_EQ(117.0, view["orders"][17]["price"].As<double>());
+	EXPECT_EQ(5U, view["orders"][5]["id"].As<uint32_t>());
+	EXPECT_EQ("tag3", view["orders"][3]["tags"][0].As<std::string>());
+}
+
+TEST_F(MsgPackViewTest, ShouldReturnTypeAndSizeOfValues)
+{
+	const MsgPackView view(mData);
+	EXPECT_TRUE(view.IsMap());
+	EXPECT_EQ(3U, view.GetSize());
+
+	const auto orders = view["orders"];
+	EXPECT_TRUE(orders.IsArray());
+	EXPECT_EQ(20U, orders.GetSize());
+
+	EXPECT_EQ(MsgPackView::ValueType::String, view["source"].GetValueType());
+	EXPECT_EQ(0U, view["source"].GetSize());
+}
+
+TEST_F(MsgPackViewTest, ShouldLoadNodeToObject)
+{
+	const MsgPackView view(mData);
+	TestOrder order;
+	view["orders"][7].Load(order);
+	EXPECT_EQ(mMessage.Orders[7], order);
+
+	std::vector<TestOrder> orders;
+	view["orders"].Load(orders);
+	EXPECT_EQ(mMessage.Orders, orders);
+
+	EXPECT_EQ(mMessage.Attributes, (view["attributes"].As<std::map<std::string, int>>()));
+}
+
+TEST_F(MsgPackViewTest, ShouldReturnRawDataOfNode)
+{
+	const MsgPackView view(mData);
+	EXPECT_EQ(mData, view.GetRawData());
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(mMessage.Orders[2]), view["orders"][2].GetRawData());
+	EXPECT_EQ(BitSerializer::SaveObject<MsgPackArchive>(mMessage.Attributes), view["attributes"].GetRawData());
+}
+
+TEST_F(MsgPackViewTest, ShouldIterateOverKeysAndValuesOfMap)
+{
+	const MsgPackView view(mData);
+	const auto attributes = view["attributes"];
+	ASSERT_EQ(2U, attributes.GetSize());
+	EXPECT_EQ("a", attributes.GetKey(0).As<std::string>());
+	EXPECT_EQ(1, attributes.GetValue(0).As<int>());
+	EXPECT_EQ("b", attributes.GetKey(1).As<std::string>());
+	EXPECT_EQ(2, attributes.GetValue(1).As<int>());
+	EXPECT_THROW((void)attributes.GetValue(2), SerializationException);
+}
+
+TEST_F(MsgPackViewTest, ShouldFindValueByPath)
+{
+	const MsgPackView view(mData);
+	const auto price = view.FindPath("/orders/17/price");
+	ASSERT_TRUE(price.has_value());
+	EXPECT_EQ(117.0, price->As<double>());
+
+	EXPECT_EQ(view.GetRawData(), view.FindPath("")->GetRawData());
+	EXPECT_FALSE(view.FindPath("/orders/20/price").has_value());
+	EXPECT_FALSE(view.FindPath("/orders/x").has_value());
+	EXPECT_FALSE(view.FindPath("/unknown").has_value());
+	EXPECT_FALSE(view.FindPath("/source/0").has_value());
+}
+
+TEST_F(MsgPackViewTest, ShouldReturnNulloptWhenKeyIsNotFound)
+{
+	const MsgPackView view(mData);
+	EXPECT_FALSE(view.Find("unknown").has_value());
+	EXPECT_FALSE(view["orders"].Find("id").has_value());
+}
+
+TEST_F(MsgPackViewTest, ShouldThrowExceptionWhenAccessToMissedValue)
+{
+	const MsgPackView view(mData);
+	EXPECT_THROW((void)view["unknown"], SerializationException);
+	EXPECT_THROW((void)view["orders"][20], SerializationException);
+	EXPECT_THROW((void)view["orders"]["id"], SerializationException);
+	EXPECT_THROW((void)view[0], SerializationException);
+}
+
+TEST_F(MsgPackViewTest, ShouldThrowExceptionWhenDocumentIsTruncated)
+{
+	const MsgPackView view(std::string_view(mData).substr(0, mData.size() - 10));
+	EXPECT_EQ("exchange", view["source"].As<std::string>());
+	EXPECT_THROW((void)view["attributes"], ParsingException);
+}
@@ -724,6 +724,28 @@ TEST(RapidJsonArchive, SerializeStdOptionalAsObjectMember)
 	TestSerializeType<JsonArchive, TestClassWithSubType<std::optional<std::vector<int>>>>(TestClassWithSubType(std::optional<std::vector<int>>(std::nullopt)));
 }
 
+//-----------------------------------------------------------------------------
+// Tests of saving to strings with custom allocators
+//-----------------------------------------------------------------------------
+// PMR containers on Apple is supported since C++ 20
+#if defined(__cpp_lib_memory_resource) && (!defined __apple_build_version__ || ((defined(_MSVC_LANG) && _MSVC_LANG >= 202002L) || __cplusplus >= 202002L))
+TEST(RapidJsonArchive, SaveObjectToPmrString)
+{
+	// Arrange
+	auto testObj = BuildFixture<TestClassWithSubTypes<int64_t, std::string, bool>>();
+	const std::string expected = BitSerializer::SaveObject<JsonArchive>(testObj);
+	char arena[16 * 1024];
+	std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+	std::pmr::string actual("previous content", &resource);
+
+	// Act
+	BitSerializer::SaveObject<JsonArchive>(testObj, actual);
+
+	// Assert
+	EXPECT_EQ(expected, std::string_view(actual));
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // Smoke tests of STD types serialization (more detailed tests in "unit_tests/std_types_tests")
 //-----------------------------------------------------------------------------
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "common/binary_segments_reader.h"
+
+class BinarySegmentsReaderTest : public ::testing::Test
+{
+public:
+	using reader_type = BitSerializer::Detail::CBinarySegmentsReader;
+
+	/**
+	 * @brief Prepares the reader over the test data which is split into segments of the passed sizes.
+	 */
+	void PrepareSegmentsReader(const std::vector<size_t>& segmentSizes)
+	{
+		mInputString.clear();
+		mSegments.clear();
+		for (const size_t segmentSize : segmentSizes)
+		{
+			for (size_t i = 0; i < segmentSize; ++i)
+			{
+				mInputString.push_back(static_cast<char>('A' + mInputString.size() % 26));
+			}
+		}
+
+		const std::string_view inputData(mInputString);
+		size_t pos = 0;
+		for (const size_t segmentSize : segmentSizes)
+		{
+			mSegments.emplace_back(inputData.substr(pos, segmentSize));
+			pos += segmentSize;
+		}
+		mBinarySegmentsReader = std::make_shared<reader_type>(BitSerializer::SegmentedInput(mSegments));
+	}
+
+	[[nodiscard]] bool IsInInputString(std::string_view block) const noexcept
+	{
+		return block.data() >= mInputString.data() && block.data() + block.size() <= mInputString.data() + mInputString.size();
+	}
+
+protected:
+	std::string mInputString;
+	std::vector<std::string_view> mSegments;
+	std::shared_ptr<reader_type> mBinarySegmentsReader;
+};
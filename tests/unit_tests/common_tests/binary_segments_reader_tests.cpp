@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include <gtest/gtest.h>
+#include "binary_segments_reader_fixture.h"
+
+using namespace BitSerializer::Detail;
+
+//-----------------------------------------------------------------------------
+TEST_F(BinarySegmentsReaderTest, ShouldCheckIsEndWhenNoSegments)
+{
+	// Arrange
+	PrepareSegmentsReader({});
+
+	// Act / Assert
+	EXPECT_TRUE(mBinarySegmentsReader->IsEnd());
+	EXPECT_FALSE(mBinarySegmentsReader->PeekByte().has_value());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldCheckIsEndWhenAllSegmentsAreEmpty)
+{
+	// Arrange
+	PrepareSegmentsReader({ 0, 0, 0 });
+
+	// Act / Assert
+	EXPECT_TRUE(mBinarySegmentsReader->IsEnd());
+	EXPECT_FALSE(mBinarySegmentsReader->ReadByte().has_value());
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(BinarySegmentsReaderTest, ShouldReadBytesAcrossSegments)
+{
+	// Arrange
+	PrepareSegmentsReader({ 1, 0, 2, 3 });
+
+	// Act
+	std::string actual;
+	while (const auto byte = mBinarySegmentsReader->ReadByte()) {
+		actual.push_back(*byte);
+	}
+
+	// Assert
+	EXPECT_EQ(mInputString, actual);
+	EXPECT_EQ(mInputString.size(), mBinarySegmentsReader->GetPosition());
+	EXPECT_TRUE(mBinarySegmentsReader->IsEnd());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldGotoNextByteAcrossSegments)
+{
+	// Arrange
+	PrepareSegmentsReader({ 1, 0, 2 });
+
+	// Act
+	mBinarySegmentsReader->GotoNextByte();
+	const auto actualByte = mBinarySegmentsReader->PeekByte();
+
+	// Assert
+	ASSERT_TRUE(actualByte.has_value());
+	EXPECT_EQ(mInputString[1], actualByte.value());	// NOLINT(bugprone-unchecked-optional-access)
+	EXPECT_EQ(1U, mBinarySegmentsReader->GetPosition());
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(BinarySegmentsReaderTest, ShouldReadSolidBlockWithoutCopyingWhenItFitsIntoSegment)
+{
+	// Arrange
+	PrepareSegmentsReader({ 4, 4 });
+
+	// Act
+	const auto actualBlock1 = mBinarySegmentsReader->ReadExactly(4);
+	const auto actualBlock2 = mBinarySegmentsReader->ReadExactly(3);
+
+	// Assert
+	EXPECT_EQ(mInputString.substr(0, 4), actualBlock1);
+	EXPECT_EQ(mInputString.substr(4, 3), actualBlock2);
+	EXPECT_TRUE(IsInInputString(actualBlock1));
+	EXPECT_TRUE(IsInInputString(actualBlock2));
+	EXPECT_EQ(7U, mBinarySegmentsReader->GetPosition());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldReadSolidBlockWhichStraddlesSegments)
+{
+	// Arrange
+	PrepareSegmentsReader({ 2, 1, 0, 3, 2 });
+	mBinarySegmentsReader->GotoNextByte();
+
+	// Act
+	const auto actualBlock = mBinarySegmentsReader->ReadExactly(6);
+
+	// Assert
+	EXPECT_EQ(mInputString.substr(1, 6), actualBlock);
+	EXPECT_FALSE(IsInInputString(actualBlock));
+	EXPECT_EQ(7U, mBinarySegmentsReader->GetPosition());
+	EXPECT_FALSE(mBinarySegmentsReader->IsEnd());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldReadSolidBlockEmptyWhenInputDataSizeIsLess)
+{
+	// Arrange
+	PrepareSegmentsReader({ 2, 2 });
+
+	// Act
+	const auto actualBlock = mBinarySegmentsReader->ReadExactly(5);
+
+	// Assert
+	EXPECT_TRUE(actualBlock.empty());
+	EXPECT_EQ(0U, mBinarySegmentsReader->GetPosition());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldReadByChunkUpToEndOfSegment)
+{
+	// Arrange
+	PrepareSegmentsReader({ 3, 0, 5 });
+
+	// Act
+	const auto actualChunk1 = mBinarySegmentsReader->ReadUpTo(6);
+	const auto actualChunk2 = mBinarySegmentsReader->ReadUpTo(6);
+	const auto actualChunk3 = mBinarySegmentsReader->ReadUpTo(6);
+
+	// Assert
+	EXPECT_EQ(mInputString.substr(0, 3), actualChunk1);
+	EXPECT_EQ(mInputString.substr(3, 5), actualChunk2);
+	EXPECT_TRUE(actualChunk3.empty());
+	EXPECT_TRUE(mBinarySegmentsReader->IsEnd());
+}
+
+//-----------------------------------------------------------------------------
+TEST_F(BinarySegmentsReaderTest, ShouldSetPositionForwardAndBackAcrossSegments)
+{
+	// Arrange
+	PrepareSegmentsReader({ 3, 0, 4, 2 });
+
+	// Act / Assert
+	ASSERT_TRUE(mBinarySegmentsReader->SetPosition(8));
+	EXPECT_EQ(mInputString[8], mBinarySegmentsReader->PeekByte());
+	ASSERT_TRUE(mBinarySegmentsReader->SetPosition(3));
+	EXPECT_EQ(mInputString[3], mBinarySegmentsReader->PeekByte());
+	ASSERT_TRUE(mBinarySegmentsReader->SetPosition(0));
+	EXPECT_EQ(mInputString[0], mBinarySegmentsReader->PeekByte());
+	EXPECT_EQ(0U, mBinarySegmentsReader->GetPosition());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldSetPositionBackWhenReachedEnd)
+{
+	// Arrange
+	PrepareSegmentsReader({ 2, 2 });
+	ASSERT_TRUE(mBinarySegmentsReader->SetPosition(4));
+	ASSERT_TRUE(mBinarySegmentsReader->IsEnd());
+
+	// Act
+	const bool result = mBinarySegmentsReader->SetPosition(1);
+
+	// Assert
+	ASSERT_TRUE(result);
+	EXPECT_FALSE(mBinarySegmentsReader->IsEnd());
+	EXPECT_EQ(mInputString[1], mBinarySegmentsReader->PeekByte());
+}
+
+TEST_F(BinarySegmentsReaderTest, ShouldSetPositionFailWhenItAfterTheEnd)
+{
+	// Arrange
+	PrepareSegmentsReader({ 2, 2 });
+
+	// Act
+	const bool result = mBinarySegmentsReader->SetPosition(5);
+
+	// Assert
+	ASSERT_FALSE(result);
+	EXPECT_TRUE(mBinarySegmentsReader->IsFailed());
+	EXPECT_EQ(0U, mBinarySegmentsReader->GetPosition());
+}
@@ -10,10 +10,11 @@
 class BinaryStreamReaderTest : public ::testing::Test
 {
 public:
-	// Use minimal chunk size for simplify testing all streaming cases
 	using reader_type = BitSerializer::Detail::CBinaryStreamReader;
+	// Use small chunk size for simplify testing all streaming cases
+	static constexpr size_t chunk_size = 256u;
 
-	void PrepareStreamReader(size_t testSize)
+	void PrepareStreamReader(size_t testSize, bool allowGrow = false)
 	{
 		mInputString.clear();
 		for (size_t i = 0; i < testSize; ++i)
@@ -23,13 +24,13 @@ public:
 
 		// Prepare stream reader
 		mInputStream = std::stringstream(mInputString);
-		mBinaryStreamReader = std::make_shared<reader_type>(mInputStream);
+		mBinaryStreamReader = std::make_shared<reader_type>(mInputStream, chunk_size, allowGrow);
 	}
 
 	[[nodiscard]] std::string ReadByChunks(size_t testSize) const
 	{
 		std::string actual;
-		const size_t maxIterations = testSize / reader_type::chunk_size + 1;
+		const size_t maxIterations = testSize / chunk_size + 1;
 		size_t remainingSize = testSize;
 		for (size_t i = 0; i < maxIterations; ++i)
 		{
@@ -2,13 +2,14 @@
 * Copyright (C) 2018-2024 by Pavel Kisliak                                     *
 * This file is part of BitSerializer library, licensed under the MIT license.  *
 *******************************************************************************/
+#include <limits>
 #include <gtest/gtest.h>
 #include "testing_tools/common_test_entities.h"
 #include "binary_stream_reader_fixture.h"
 
 using namespace BitSerializer::Detail;
 
-static_assert((CBinaryStreamReader::chunk_size % 8) == 0, "Chunk size must be a multiple of 8");
+static_assert((BinaryStreamReaderTest::chunk_size % 8) == 0, "Chunk size must be a multiple of 8");
 
 //-----------------------------------------------------------------------------
 TEST_F(BinaryStreamReaderTest, ShouldCheckIsEndWhenEmptyInputStream)
@@ -36,8 +37,8 @@ TEST_F(BinaryStreamReaderTest, ShouldCheckIsEndWhenItInTheCachedChunk)
 TEST_F(BinaryStreamReaderTest, ShouldCheckIsEndWhenInputDataGreaterThanChunk)
 {
 	// Arrange
-	PrepareStreamReader(reader_type::chunk_size + 1);
-	const auto skippedChunk = mBinaryStreamReader->ReadExactly(reader_type::chunk_size);
+	PrepareStreamReader(chunk_size + 1);
+	const auto skippedChunk = mBinaryStreamReader->ReadExactly(chunk_size);
 
 	// Act / Assert
 	ASSERT_FALSE(skippedChunk.empty());
@@ -130,7 +131,7 @@ TEST_F(BinaryStreamReaderTest, ShouldSetPositionWhenItInTheCachedChunk)
 TEST_F(BinaryStreamReaderTest, ShouldSetPositionWhenItAfterCachedChunk)
 {
 	// Arrange
-	constexpr size_t testPos = reader_type::chunk_size + 1;
+	constexpr size_t testPos = chunk_size + 1;
 	PrepareStreamReader(testPos + 1);
 
 	// Act
@@ -165,7 +166,7 @@ TEST_F(BinaryStreamReaderTest, ShouldSetPositionWhenItBeforeCachedChunk)
 	PrepareStreamReader(testPos + 1);
 
 	// Act
-	const auto solidBlock = mBinaryStreamReader->ReadExactly(reader_type::chunk_size);
+	const auto solidBlock = mBinaryStreamReader->ReadExactly(chunk_size);
 	const bool result = mBinaryStreamReader->SetPosition(testPos);
 	const auto actualByte = mBinaryStreamReader->PeekByte();
 
@@ -177,6 +178,28 @@ TEST_F(BinaryStreamReaderTest, ShouldSetPositionWhenItBeforeCachedChunk)
 	EXPECT_EQ(mInputString[testPos], actualByte.value());	// NOLINT(bugprone-unchecked-optional-access)
 }
 
+TEST_F(BinaryStreamReaderTest, ShouldSetPositionBeforeCachedChunkWhenReachedEndOfStream)
+{
+	// Arrange
+	constexpr size_t testPos = 1;
+	constexpr size_t testSize = chunk_size * 2 + 1;
+	PrepareStreamReader(testSize);
+
+	// Act
+	const std::string actualData = ReadByChunks(testSize);
+	const bool isEnd = mBinaryStreamReader->IsEnd();
+	const bool result = mBinaryStreamReader->SetPosition(testPos);
+	const auto actualByte = mBinaryStreamReader->PeekByte();
+
+	// Assert
+	ASSERT_TRUE(result);
+	EXPECT_TRUE(isEnd);
+	EXPECT_EQ(mInputString, actualData);
+	EXPECT_EQ(testPos, mBinaryStreamReader->GetPosition());
+	ASSERT_TRUE(actualByte.has_value());
+	EXPECT_EQ(mInputString[testPos], actualByte.value());	// NOLINT(bugprone-unchecked-optional-access)
+}
+
 TEST_F(BinaryStreamReaderTest, ShouldSetPositionFailWhenItAfterTheEnd)
 {
 	// Arrange
@@ -311,10 +334,10 @@ TEST_F(BinaryStreamReaderTest, ShouldReadByteEmptyWhenReachedEnd)
 TEST_F(BinaryStreamReaderTest, ShouldReadSolidBlockWhenSizeEqualToChunk)
 {
 	// Arrange
-	PrepareStreamReader(reader_type::chunk_size);
+	PrepareStreamReader(chunk_size);
 
 	// Act
-	const std::string actual(mBinaryStreamReader->ReadExactly(reader_type::chunk_size));
+	const std::string actual(mBinaryStreamReader->ReadExactly(chunk_size));
 
 	// Assert
 	ASSERT_EQ(mInputString.size(), actual.size());
@@ -341,7 +364,7 @@ TEST_F(BinaryStreamReaderTest, ShouldReadSolidBlockWhenSizeLessThanChunk)
 TEST_F(BinaryStreamReaderTest, ShouldReadMultipleSolidBlocksExceedChunkSize)
 {
 	// Arrange
-	constexpr uint16_t expectedFirstChunkSize = reader_type::chunk_size - 3;
+	constexpr uint16_t expectedFirstChunkSize = chunk_size - 3;
 	constexpr uint16_t expectedSecondChunkSize = 4;
 	PrepareStreamReader(expectedFirstChunkSize + expectedSecondChunkSize);
 
@@ -373,15 +396,15 @@ TEST_F(BinaryStreamReaderTest, ShouldReadSolidBlockEmptyWhenEmptySource)
 TEST_F(BinaryStreamReaderTest, ShouldReadSolidBlockEmptyWhenNoMoreData)
 {
 	// Arrange
-	PrepareStreamReader(reader_type::chunk_size + 1);
+	PrepareStreamReader(chunk_size + 1);
 
 	// Act
-	const std::string actual1(mBinaryStreamReader->ReadExactly(reader_type::chunk_size));
+	const std::string actual1(mBinaryStreamReader->ReadExactly(chunk_size));
 	const std::string actual2(mBinaryStreamReader->ReadExactly(2));
 
 	// Assert
-	ASSERT_EQ(reader_type::chunk_size, actual1.size());
-	EXPECT_EQ(mInputString.substr(0, reader_type::chunk_size), actual1);
+	ASSERT_EQ(chunk_size, actual1.size());
+	EXPECT_EQ(mInputString.substr(0, chunk_size), actual1);
 	EXPECT_TRUE(actual2.empty());
 	EXPECT_FALSE(mBinaryStreamReader->IsEnd());
 }
@@ -404,7 +427,7 @@ TEST_F(BinaryStreamReaderTest, ShouldReadSolidBlockEmptyWhenInputDataSizeIsLess)
 TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenSizeEqualToChunk)
 {
 	// Arrange
-	constexpr size_t testSize = reader_type::chunk_size;
+	constexpr size_t testSize = chunk_size;
 	PrepareStreamReader(testSize);
 
 	// Act
@@ -419,7 +442,7 @@ TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenSizeEqualToChunk)
 TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenSizeLessThanChunk)
 {
 	// Arrange
-	constexpr size_t testSize = reader_type::chunk_size - 1;
+	constexpr size_t testSize = chunk_size - 1;
 	PrepareStreamReader(testSize);
 
 	// Act
@@ -434,7 +457,7 @@ TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenSizeLessThanChunk)
 TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenSizeGreaterThanChunk)
 {
 	// Arrange
-	constexpr size_t testSize = reader_type::chunk_size + 1;
+	constexpr size_t testSize = chunk_size + 1;
 	PrepareStreamReader(testSize);
 
 	// Act
@@ -450,7 +473,7 @@ TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenSizeGreaterThanChunk)
 TEST_F(BinaryStreamReaderTest, ShouldReadByChunkWhenMultipleChunks)
 {
 	// Arrange
-	constexpr size_t testSize = reader_type::chunk_size * 3 + reader_type::chunk_size - 1;
+	constexpr size_t testSize = chunk_size * 3 + chunk_size - 1;
 	PrepareStreamReader(testSize);
 
 	// Act
@@ -489,3 +512,92 @@ TEST_F(BinaryStreamReaderTest, ShouldReadByChunkEmptyWhenInputDataSizeIsLess)
 	EXPECT_EQ(mInputString, actual);
 	EXPECT_TRUE(mBinaryStreamReader->IsEnd());
 }
+
+//-----------------------------------------------------------------------------
+
+TEST_F(BinaryStreamReaderTest, ShouldUseMinimalChunkSizeWhenPassedTooSmall)
+{
+	// Arrange
+	std::istringstream inputStream("test");
+
+	// Act
+	const reader_type binaryStreamReader(inputStream, 1);
+
+	// Assert
+	EXPECT_EQ(reader_type::min_chunk_size, binaryStreamReader.GetChunkSize());
+	EXPECT_EQ(reader_type::min_chunk_size, binaryStreamReader.GetMaxBlockSize());
+}
+
+TEST_F(BinaryStreamReaderTest, ShouldReturnUnlimitedMaxBlockSizeWhenGrowAllowed)
+{
+	// Arrange
+	PrepareStreamReader(1, true);
+
+	// Act / Assert
+	EXPECT_EQ(chunk_size, mBinaryStreamReader->GetChunkSize());
+	EXPECT_EQ((std::numeric_limits<size_t>::max)(), mBinaryStreamReader->GetMaxBlockSize());
+}
+
+TEST_F(BinaryStreamReaderTest, ShouldGrowBufferWhenReadSolidBlockGreaterThanChunk)
+{
+	// Arrange
+	constexpr size_t testBlockSize = chunk_size * 3 + 5;
+	PrepareStreamReader(testBlockSize + 10, true);
+	const std::string firstBlock(mBinaryStreamReader->ReadExactly(10));
+
+	// Act
+	const std::string actual(mBinaryStreamReader->ReadExactly(testBlockSize));
+
+	// Assert
+	EXPECT_EQ(mInputString.substr(0, 10), firstBlock);
+	ASSERT_EQ(testBlockSize, actual.size());
+	EXPECT_EQ(mInputString.substr(10), actual);
+	EXPECT_LE(testBlockSize, mBinaryStreamReader->GetChunkSize());
+	EXPECT_TRUE(mBinaryStreamReader->IsEnd());
+}
+
+TEST_F(BinaryStreamReaderTest, ShouldKeepPositionAfterGrowBuffer)
+{
+	// Arrange
+	constexpr size_t testBlockSize = chunk_size * 2;
+	PrepareStreamReader(testBlockSize * 2, true);
+	const std::string skippedBlock(mBinaryStreamReader->ReadExactly(3));
+
+	// Act
+	const std::string actual1(mBinaryStreamReader->ReadExactly(testBlockSize));
+	const size_t actualPos = mBinaryStreamReader->GetPosition();
+	const std::string actual2 = ReadByChunks(testBlockSize - 3);
+
+	// Assert
+	EXPECT_EQ(mInputString.substr(0, 3), skippedBlock);
+	EXPECT_EQ(testBlockSize + 3, actualPos);
+	EXPECT_EQ(mInputString.substr(3, testBlockSize), actual1);
+	EXPECT_EQ(mInputString.substr(testBlockSize + 3), actual2);
+	EXPECT_TRUE(mBinaryStreamReader->IsEnd());
+}
+
+TEST_F(BinaryStreamReaderTest, ShouldGrowBufferOnlyWhileDataArrives)
+{
+	// Arrange
+	PrepareStreamReader(chunk_size * 3, true);
+
+	// Act
+	const std::string_view actual = mBinaryStreamReader->ReadExactly(0xFFFFFFFFu);
+
+	// Assert
+	EXPECT_TRUE(actual.empty());
+	EXPECT_GE(chunk_size * 4, mBinaryStreamReader->GetChunkSize());
+}
+
+TEST_F(BinaryStreamReaderTest, ShouldReadBlockEmptyWhenStreamEndsBeforeGrowBuffer)
+{
+	// Arrange
+	constexpr size_t testBlockSize = chunk_size * 5;
+	PrepareStreamReader(testBlockSize - 1, true);
+
+	// Act
+	const std::string_view actual = mBinaryStreamReader->ReadExactly(testBlockSize);
+
+	// Assert
+	EXPECT_TRUE(actual.empty());
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright (C) 2018-2026 by Pavel Kisliak                                     *
+* This file is part of BitSerializer library, licensed under the MIT license.  *
+*******************************************************************************/
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include "bitserializer/common/mapped_file.h"
+
+using namespace BitSerializer::Detail;
+
+namespace
+{
+	std::filesystem::path PrepareTestFile(const std::string& fileName, const std::string& content)
+	{
+		auto testFilePath = std::filesystem::temp_directory_path() / fileName;
+		std::ofstream stream(testFilePath, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+		stream << content;
+		return testFilePath;
+	}
+}
+
+//-----------------------------------------------------------------------------
+#if BITSERIALIZER_HAS_MAPPED_FILES
+TEST(MappedFileTest, ShouldMapContentOfFile)
+{
+	// Arrange
+	const std::string expected("Test\0content", 12);
+	const auto testFilePath = PrepareTestFile("TestMappedFile.bin", expected);
+	CMappedFile mappedFile;
+
+	// Act
+	const bool actualResult = mappedFile.Open(testFilePath.string().c_str());
+
+	// Assert
+	ASSERT_TRUE(actualResult);
+	EXPECT_TRUE(mappedFile.IsOpen());
+	EXPECT_EQ(expected, mappedFile.GetData());
+}
+#endif
+
+TEST(MappedFileTest, ShouldReturnFalseWhenFileNotExists)
+{
+	// Arrange
+	const auto testFilePath = std::filesystem::temp_directory_path() / "NotExistingMappedFile.bin";
+	std::filesystem::remove(testFilePath);
+	CMappedFile mappedFile;
+
+	// Act / Assert
+	EXPECT_FALSE(mappedFile.Open(testFilePath.string().c_str()));
+	EXPECT_FALSE(mappedFile.IsOpen());
+	EXPECT_TRUE(mappedFile.GetData().empty());
+}
+
+TEST(MappedFileTest, ShouldReturnFalseWhenFileIsEmpty)
+{
+	// Arrange
+	const auto testFilePath = PrepareTestFile("TestMappedEmptyFile.bin", {});
+	CMappedFile mappedFile;
+
+	// Act / Assert
+	EXPECT_FALSE(mappedFile.Open(testFilePath.string().c_str()));
+	EXPECT_FALSE(mappedFile.IsOpen());
+}
+
+TEST(MappedFileTest, ShouldReturnFalseWhenPathIsDirectory)
+{
+	// Arrange
+	CMappedFile mappedFile;
+
+	// Act / Assert
+	EXPECT_FALSE(mappedFile.Open(std::filesystem::temp_directory_path().string().c_str()));
+	EXPECT_FALSE(mappedFile.IsOpen());
+}
+
+TEST(MappedFileTest, ShouldUnmapWhenClose)
+{
+	// Arrange
+	const auto testFilePath = PrepareTestFile("TestMappedFile.bin", "Test");
+	CMappedFile mappedFile;
+	ASSERT_EQ(BITSERIALIZER_HAS_MAPPED_FILES != 0, mappedFile.Open(testFilePath.string().c_str()));
+
+	// Act
+	mappedFile.Close();
+
+	// Assert
+	EXPECT_FALSE(mappedFile.IsOpen());
+	EXPECT_TRUE(mappedFile.GetData().empty());
+}
@@ -34,6 +34,8 @@ public:
 	std::optional<TestArchive_LoadMode> OpenBinaryScope(size_t) { return std::nullopt; }
 	std::optional<TestArchive_LoadMode> OpenAttributeScope() { return std::nullopt; }
 
+	size_t SerializeBlock(char*, size_t size) { return size; }
+
 	[[nodiscard]] size_t GetEstimatedSize() const { return 0; }
 };
 
@@ -192,6 +194,15 @@ TEST(SerializationArchiveTraits, ShouldCheckThatArchiveCanSerializeBinArrayWithK
 	EXPECT_FALSE(testResult3);
 }
 
+TEST(SerializationArchiveTraits, ShouldCheckThatArchiveCanSerializeBlock) {
+	bool testResult1 = can_serialize_block_v<TestArchive_LoadMode, char>;
+	EXPECT_TRUE(testResult1);
+	bool testResult2 = can_serialize_block_v<TestArchive_LoadMode, double>;
+	EXPECT_FALSE(testResult2);
+	bool testResult3 = can_serialize_block_v<TestWrongArchive, char>;
+	EXPECT_FALSE(testResult3);
+}
+
 TEST(SerializationArchiveTraits, ShouldCheckThatArchiveCanSerializeAttribute) {
 	bool testResult1 = can_serialize_attribute_v<TestArchive_LoadMode>;
 	EXPECT_TRUE(testResult1);
@@ -4,6 +4,7 @@
 *******************************************************************************/
 #include <gtest/gtest.h>
 #include <sstream>
+#include <array>
 #include <vector>
 #include <list>
 #include <map>
@@ -83,9 +84,11 @@ TEST(SerializationObjectTraits, ShouldCheckThatTypeIsEnumerable) {
 	EXPECT_TRUE(testResult1);
 	const bool testResult2 = is_enumerable_v<std::forward_list<int>>;
 	EXPECT_TRUE(testResult2);
+	const bool testResult3 = is_enumerable_v<std::array<int, 3>>;
+	EXPECT_TRUE(testResult3);
 
-	const bool testResult3 = is_enumerable_v<TestNotSerializableClass>;
-	EXPECT_FALSE(testResult3);
+	const bool testResult4 = is_enumerable_v<TestNotSerializableClass>;
+	EXPECT_FALSE(testResult4);
 }
 
 TEST(SerializationObjectTraits, ShouldCheckThatTypeIsEnumerableOfType) {
@@ -105,8 +108,34 @@ TEST(SerializationObjectTraits, ShouldCheckThatTypeIsBinaryContainer) {
 	EXPECT_TRUE(testResult2);
 	const bool testResult3 = is_binary_container<std::forward_list<uint8_t>>;
 	EXPECT_TRUE(testResult3);
+	const bool testResult4 = is_binary_container<std::array<std::byte, 3>>;
+	EXPECT_TRUE(testResult4);
+
+	const bool testResult5 = is_binary_container<std::list<int>>;
+	EXPECT_FALSE(testResult5);
+}
+
+TEST(SerializationObjectTraits, ShouldCheckThatTypeIsContiguousBinaryContainer) {
+	const bool testResult1 = is_contiguous_binary_container_v<std::vector<char>>;
+	EXPECT_TRUE(testResult1);
+	const bool testResult2 = is_contiguous_binary_container_v<std::array<std::byte, 3>>;
+	EXPECT_TRUE(testResult2);
 
-	const bool testResult4 = is_binary_container<std::list<int>>;
+	const bool testResult3 = is_contiguous_binary_container_v<std::list<char>>;
+	EXPECT_FALSE(testResult3);
+	const bool testResult4 = is_contiguous_binary_container_v<std::vector<int>>;
+	EXPECT_FALSE(testResult4);
+}
+
+TEST(SerializationObjectTraits, ShouldCheckThatTypeIsContiguousArithmeticContainer) {
+	const bool testResult1 = is_contiguous_arithmetic_container_v<std::vector<float>>;
+	EXPECT_TRUE(testResult1);
+	const bool testResult2 = is_contiguous_arithmetic_container_v<std::array<int64_t, 3>>;
+	EXPECT_TRUE(testResult2);
+
+	const bool testResult3 = is_contiguous_arithmetic_container_v<std::list<int>>;
+	EXPECT_FALSE(testResult3);
+	const bool testResult4 = is_contiguous_arithmetic_container_v<std::vector<std::string>>;
 	EXPECT_FALSE(testResult4);
 }
 
@@ -133,6 +162,13 @@ TEST(SerializationObjectTraits, ShouldCheckThatContainerHasReserveMethod) {
 	EXPECT_FALSE(testResult2);
 }
 
+TEST(SerializationObjectTraits, ShouldCheckThatContainerHasResizeMethod) {
+	const bool testResult1 = has_resize_v<std::vector<int>>;
+	EXPECT_TRUE(testResult1);
+	const bool testResult2 = has_resize_v<std::array<int, 3>>;
+	EXPECT_FALSE(testResult2);
+}
+
 TEST(SerializationObjectTraits, ShouldGetContainerSizeForVector) {
 	static constexpr size_t expectedSize = 10;
 	const std::vector<int> testContainer(expectedSize);
@@ -223,12 +259,36 @@ void SerializeObject(TArchive& archive, ExtFieldsCounterFixture& fixture)
 	archive << KeyValue("x", fixture.x) << KeyValue("y", fixture.y) << KeyValue("z", fixture.z);
 }
 
-template <bool IsBinary = false>
+struct FixedFieldsCounterFixture : IntFieldsCounterFixture
+{
+	BITSERIALIZER_FIXED_FIELDS(2);
+};
+
+struct FixedFieldsCounterFixtureWithInheritance : FixedFieldsCounterFixture
+{
+	int z = 0;
+
+	template <class TArchive>
+	void Serialize(TArchive& archive)
+	{
+		archive << BitSerializer::BaseObject<FixedFieldsCounterFixture>(*this);
+		archive << KeyValue("z", z);
+	}
+};
+
+namespace BitSerializer
+{
+	template <>
+	struct fixed_fields_count<ExtFieldsCounterFixture> : std::integral_constant<size_t, 3> {};
+}
+
+template <bool IsBinary = false, bool RequireMapSize = true>
 struct ArchiveTest
 {
 	static constexpr ArchiveType archive_type = ArchiveType::Json;
 	using key_type = std::string;
 	static constexpr bool is_binary = IsBinary;		// Only binary archive's types require counting number of fields
+	static constexpr bool require_map_size = RequireMapSize;
 
 	static constexpr SerializeMode GetMode() noexcept { return SerializeMode::Save; }
 	static constexpr bool IsSaving() noexcept { return true; }
@@ -258,12 +318,46 @@ TEST(SerializationObjectTraits, ShouldCountFieldsOfMap) {
 	EXPECT_EQ(4U, CountMapObjectFields(binArchive, val));
 }
 
+TEST(SerializationObjectTraits, ShouldNotCountObjectFieldsWhenArchiveDoesNotRequireMapSize) {
+	constexpr ArchiveTest<true, false> archive;
+	TestPointClass obj(10, 20);
+	std::map<int, int> map { {1, 1}, { 2,2 } };
+
+	EXPECT_EQ(unknown_size, CountMapObjectFields(archive, obj));
+	EXPECT_EQ(2U, CountMapObjectFields(archive, map));
+}
+
 TEST(SerializationObjectTraits, ShouldCountObjectWithBaseSerializableClass) {
 	constexpr ArchiveTest archive;
 	FieldsCounterFixtureWithInheritance val;
 	EXPECT_EQ(3U, FieldsCountVisitor(archive).Count(val));
 }
 
+TEST(SerializationObjectTraits, ShouldDetectFixedFieldsCount) {
+	EXPECT_TRUE(has_fixed_fields_count_v<FixedFieldsCounterFixture>);
+	EXPECT_TRUE(has_fixed_fields_count_v<ExtFieldsCounterFixture>);
+	EXPECT_FALSE(has_fixed_fields_count_v<IntFieldsCounterFixture>);
+	// The declaration should not be inherited
+	EXPECT_FALSE(has_fixed_fields_count_v<FixedFieldsCounterFixtureWithInheritance>);
+}
+
+TEST(SerializationObjectTraits, ShouldReturnFixedFieldsCountWithoutCounting) {
+	constexpr ArchiveTest<true> archive;
+	FixedFieldsCounterFixture val1;
+	ExtFieldsCounterFixture val2;
+	EXPECT_EQ(2U, CountMapObjectFields(archive, val1));
+	EXPECT_EQ(3U, CountMapObjectFields(archive, val2));
+
+	constexpr ArchiveTest<true, false> archiveWithoutMapSize;
+	EXPECT_EQ(2U, CountMapObjectFields(archiveWithoutMapSize, val1));
+}
+
+TEST(SerializationObjectTraits, ShouldCountObjectWithBaseClassWithFixedFields) {
+	constexpr ArchiveTest<true> archive;
+	FixedFieldsCounterFixtureWithInheritance val;
+	EXPECT_EQ(3U, CountMapObjectFields(archive, val));
+}
+
 //-----------------------------------------------------------------------------
 // Tests of compatible_fixed_t
 //-----------------------------------------------------------------------------
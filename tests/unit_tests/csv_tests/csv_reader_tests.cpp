@@ -208,6 +208,95 @@ Value1,Value2,Value3
 	EXPECT_EQ("Value2", actual);
 }
 
+TYPED_TEST(CsvReaderTest, ShouldReadValuesByHeaderNamesInDifferentOrderThanColumns)
+{
+	// Arrange
+	const std::string csv = R"(Column1,Column2,Column3,Column4
+Row1Col1,Row1Col2,Row1Col3,Row1Col4
+Row2Col1,Row2Col2,Row2Col3,Row2Col4
+Row3Col1,Row3Col2,Row3Col3,Row3Col4
+)";
+	this->PrepareCsvReader(csv, true);
+
+	// Act / Assert
+	for (const std::string row : { "Row1", "Row2", "Row3" })
+	{
+		ASSERT_TRUE(this->mCsvReader->ParseNextRow());
+		for (const std::string column : { "4", "2", "3", "1" })
+		{
+			std::string_view actual;
+			EXPECT_TRUE(this->mCsvReader->ReadValue("Column" + column, actual));
+			EXPECT_EQ(row + "Col" + column, actual);
+		}
+	}
+}
+
+TYPED_TEST(CsvReaderTest, ShouldReadValuesByHeaderNamesWhenOrderOfFieldsChangedInNextRow)
+{
+	// Arrange
+	const std::string csv = R"(Column1,Column2,Column3
+Row1Col1,Row1Col2,Row1Col3
+Row2Col1,Row2Col2,Row2Col3
+)";
+	this->PrepareCsvReader(csv, true);
+	std::string_view actual;
+
+	// Act / Assert
+	ASSERT_TRUE(this->mCsvReader->ParseNextRow());
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column3", actual));
+	EXPECT_EQ("Row1Col3", actual);
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column1", actual));
+	EXPECT_EQ("Row1Col1", actual);
+
+	ASSERT_TRUE(this->mCsvReader->ParseNextRow());
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column2", actual));
+	EXPECT_EQ("Row2Col2", actual);
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column3", actual));
+	EXPECT_EQ("Row2Col3", actual);
+}
+
+TYPED_TEST(CsvReaderTest, ShouldReturnFalseWhenReadValueByUnknownHeaderName)
+{
+	// Arrange
+	const std::string csv = R"(Column1,Column2
+Row1Col1,Row1Col2
+Row2Col1,Row2Col2
+)";
+	this->PrepareCsvReader(csv, true);
+	std::string_view actual;
+
+	// Act / Assert
+	for (const std::string_view expectedValue : { "Row1Col2", "Row2Col2" })
+	{
+		ASSERT_TRUE(this->mCsvReader->ParseNextRow());
+		EXPECT_FALSE(this->mCsvReader->ReadValue("Column3", actual));
+		EXPECT_TRUE(this->mCsvReader->ReadValue("Column2", actual));
+		EXPECT_EQ(expectedValue, actual);
+	}
+}
+
+TYPED_TEST(CsvReaderTest, ShouldReadValueByQuotedHeaderNameAfterParsingLargeQuotedValues)
+{
+	// Arrange
+	const std::string largeValue(10000, 'x');
+	const std::string csv = "\"Column,1\",Column2\r\n"
+		"\"" + largeValue + ",1\",Row1Col2\r\n"
+		"Row2Col1,\"" + largeValue + ",2\"\r\n";
+	this->PrepareCsvReader(csv, true);
+	std::string_view actual;
+
+	// Act / Assert
+	ASSERT_TRUE(this->mCsvReader->ParseNextRow());
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column,1", actual));
+	EXPECT_EQ(largeValue + ",1", actual);
+
+	ASSERT_TRUE(this->mCsvReader->ParseNextRow());
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column2", actual));
+	EXPECT_EQ(largeValue + ",2", actual);
+	EXPECT_TRUE(this->mCsvReader->ReadValue("Column,1", actual));
+	EXPECT_EQ("Row2Col1", actual);
+}
+
 TYPED_TEST(CsvReaderTest, ShouldParseWithCustomSeparator)
 {
 	// Arrange
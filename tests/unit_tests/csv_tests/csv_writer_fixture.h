@@ -5,6 +5,7 @@
 #pragma once
 #include <memory>
 #include <variant>
+#include <vector>
 #include "gtest/gtest.h"
 #include "csv/csv_writers.h"
 
@@ -28,6 +29,12 @@ public:
 			mResult = std::ostringstream();
 			mCsvWriter = std::make_shared<TWriter>(std::get<std::ostringstream>(mResult), withHeader, separator, utfEncodingErrorPolicy, streamOptions);
 		}
+		else if constexpr (std::is_same_v<TWriter, BitSerializer::Csv::Detail::CCsvBufferWriter>)
+		{
+			mBufferData.resize(BufferCapacity);
+			mResult = BitSerializer::FixedOutputBuffer(mBufferData.data(), mBufferData.size());
+			mCsvWriter = std::make_shared<TWriter>(std::get<BitSerializer::FixedOutputBuffer>(mResult), withHeader, separator);
+		}
 	}
 
 	std::string GetResult()
@@ -43,6 +50,11 @@ public:
 			{
 				return arg.str();
 			}
+			else if constexpr (std::is_same_v<T, BitSerializer::FixedOutputBuffer>)
+			{
+				EXPECT_FALSE(arg.overflowed());
+				return std::string(arg.view());
+			}
 		}, mResult);
 	}
 
@@ -52,6 +64,9 @@ public:
 	}
 
 protected:
+	static constexpr size_t BufferCapacity = 64 * 1024;
+
 	std::shared_ptr<TWriter> mCsvWriter;
-	std::variant<std::string, std::ostringstream> mResult;
+	std::vector<char> mBufferData;
+	std::variant<std::string, std::ostringstream, BitSerializer::FixedOutputBuffer> mResult;
 };
@@ -7,7 +7,8 @@
 
 
 using testing::Types;
-typedef Types<BitSerializer::Csv::Detail::CCsvStringWriter, BitSerializer::Csv::Detail::CCsvStreamWriter> Implementations;
+typedef Types<BitSerializer::Csv::Detail::CCsvStringWriter, BitSerializer::Csv::Detail::CCsvStreamWriter,
+	BitSerializer::Csv::Detail::CCsvBufferWriter> Implementations;
 
 // Tests for all implementations of ICsvWriter
 TYPED_TEST_SUITE(CsvWriterTest, Implementations, );
@@ -5,7 +5,7 @@
 #pragma once
 #include <memory>
 #include "gtest/gtest.h"
-#include "msgpack/msgpack_readers.h"
+#include "bitserializer/msgpack_archive.h"
 
 
 template <class TReader>
@@ -28,6 +28,17 @@ public:
 			mInputStream = std::make_optional<std::istringstream>(mTestMsgPack);
 			mMsgPackReader = std::make_shared<TReader>(mInputStream.value(), mSerializationOptions);
 		}
+		else if constexpr (std::is_same_v<TReader, BitSerializer::MsgPack::Detail::CMsgPackSegmentedReader>)
+		{
+			// Split to small segments of different sizes, so most of values straddle the boundaries of segments
+			mSegments.clear();
+			const std::string_view testMsgPackView(mTestMsgPack);
+			for (size_t pos = 0, segmentSize = 1; pos < testMsgPackView.size(); pos += segmentSize, segmentSize = segmentSize % 3 + 1)
+			{
+				mSegments.emplace_back(testMsgPackView.substr(pos, segmentSize));
+			}
+			mMsgPackReader = std::make_shared<TReader>(BitSerializer::SegmentedInput(mSegments), mSerializationOptions);
+		}
 	}
 
 	static std::string GenTestString(size_t size)
@@ -44,4 +55,5 @@ protected:
 	BitSerializer::SerializationOptions mSerializationOptions;
 	std::shared_ptr<TReader> mMsgPackReader;
 	std::optional<std::istringstream> mInputStream;
+	std::vector<std::string_view> mSegments;
 };
@@ -8,7 +8,8 @@
 
 
 using testing::Types;
-typedef Types<BitSerializer::MsgPack::Detail::CMsgPackStringReader, BitSerializer::MsgPack::Detail::CMsgPackStreamReader> Implementations;
+typedef Types<BitSerializer::MsgPack::Detail::CMsgPackStringReader, BitSerializer::MsgPack::Detail::CMsgPackStreamReader,
+	BitSerializer::MsgPack::Detail::CMsgPackSegmentedReader> Implementations;
 
 // Tests for all implementations of IMsgPackWriter
 TYPED_TEST_SUITE(MsgPackReaderTest, Implementations, );
@@ -491,6 +492,67 @@ TYPED_TEST(MsgPackReaderTest, ShouldSkipDoubleWhenPolicyIsSkip)
 	EXPECT_TRUE(this->mMsgPackReader->IsEnd()) << "Value should be skipped";
 }
 
+//-----------------------------------------------------------------------------
+// Tests of reading sequences of numbers
+//-----------------------------------------------------------------------------
+TYPED_TEST(MsgPackReaderTest, ShouldReadSequenceOfFloats)
+{
+	this->PrepareReader("\xCA\x40\x48\xF5\xC3\xCA\x40\x48\xF5\xC3\xCA\x40\x48\xF5\xC3");
+	float values[3]{};
+
+	this->mMsgPackReader->ReadValues(values, std::size(values));
+	EXPECT_FLOAT_EQ(3.14f, values[0]);
+	EXPECT_FLOAT_EQ(3.14f, values[1]);
+	EXPECT_FLOAT_EQ(3.14f, values[2]);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldReadSequenceOfDoublesStoredInDifferentFormats)
+{
+	this->PrepareReader("\xCB\x40\x09\x21\xFB\x54\x52\x45\x50\xCA\x40\x48\xF5\xC3\xCB\x40\x09\x21\xFB\x54\x52\x45\x50");
+	double values[3]{};
+
+	this->mMsgPackReader->ReadValues(values, std::size(values));
+	EXPECT_DOUBLE_EQ(3.141592654, values[0]);
+	EXPECT_FLOAT_EQ(3.14f, static_cast<float>(values[1]));
+	EXPECT_DOUBLE_EQ(3.141592654, values[2]);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldReadSequenceOfIntegers)
+{
+	this->PrepareReader(std::string({ '\x01', '\xE0', '\xD0', '\xDF', '\xD1', '\x00', '\xC8', '\xCC', '\xC8' }));
+	int16_t values[5]{};
+
+	this->mMsgPackReader->ReadValues(values, std::size(values));
+	EXPECT_EQ(1, values[0]);
+	EXPECT_EQ(-32, values[1]);
+	EXPECT_EQ(-33, values[2]);
+	EXPECT_EQ(200, values[3]);
+	EXPECT_EQ(200, values[4]);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldSkipMismatchedValuesInSequenceWhenPolicyIsSkip)
+{
+	this->PrepareReader("\xCA\x40\x48\xF5\xC3\xA1X\xCA\x40\x48\xF5\xC3",
+		BitSerializer::OverflowNumberPolicy::ThrowError, BitSerializer::MismatchedTypesPolicy::Skip);
+	float values[3]{};
+
+	this->mMsgPackReader->ReadValues(values, std::size(values));
+	EXPECT_FLOAT_EQ(3.14f, values[0]);
+	EXPECT_EQ(0.0f, values[1]);
+	EXPECT_FLOAT_EQ(3.14f, values[2]);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadSequenceOfNumbersAfterEnd)
+{
+	this->PrepareReader("\xCA\x40\x48\xF5\xC3\xCA\x40");
+	float values[2]{};
+	EXPECT_THROW(this->mMsgPackReader->ReadValues(values, std::size(values)), BitSerializer::ParsingException);
+}
+
 //-----------------------------------------------------------------------------
 // Tests of reading strings
 //-----------------------------------------------------------------------------
@@ -545,6 +607,28 @@ TYPED_TEST(MsgPackReaderTest, ShouldReadStringWhenSizeFitToUint32)
 	EXPECT_EQ(std::hash<std::string>()(expectedStr), std::hash<std::string_view>()(actualStr));
 }
 
+TYPED_TEST(MsgPackReaderTest, ShouldReadSequenceOfMediumSizeStrings)
+{
+	// Strings cross the boundaries of the read window of stream reader
+	std::string inputData;
+	std::vector<std::string> expectedStrings;
+	for (size_t i = 0; i < 7; ++i)
+	{
+		expectedStrings.emplace_back(this->GenTestString(3000 + i * 500));
+		const auto size = static_cast<uint16_t>(expectedStrings.back().size());
+		inputData += std::string({ '\xDA', static_cast<char>(size >> 8), static_cast<char>(size & 0xFF) }) + expectedStrings.back();
+	}
+	this->PrepareReader(inputData);
+
+	for (const auto& expectedStr : expectedStrings)
+	{
+		std::string_view actualStr;
+		EXPECT_TRUE(this->mMsgPackReader->ReadValue(actualStr));
+		EXPECT_EQ(expectedStr, actualStr);
+	}
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
 TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenUnexpectedEndOfString)
 {
 	std::string_view actualStr;
@@ -640,6 +724,65 @@ TYPED_TEST(MsgPackReaderTest, ShouldReadArrayWhenSizeFitToUint32)
 	EXPECT_EQ(0x40302010U, size);
 }
 
+TYPED_TEST(MsgPackReaderTest, ShouldReadTypedArraySize)
+{
+	this->PrepareReader({ '\xC7', '\x05', '\x10', '\x12', '\x02', '\x01', '\xFE', '\xFF' });
+	size_t size = 0;
+	auto itemType = BitSerializer::MsgPack::Detail::TypedArrayItemType::None;
+
+	ASSERT_TRUE(this->mMsgPackReader->ReadArraySize(size, itemType));
+	EXPECT_EQ(2U, size);
+	EXPECT_EQ(BitSerializer::MsgPack::Detail::TypedArrayItemType::Int16, itemType);
+
+	int16_t values[2] = {};
+	BitSerializer::MsgPack::Detail::ReadTypedArrayItems(*this->mMsgPackReader, values, std::size(values));
+	EXPECT_EQ(0x0102, values[0]);
+	EXPECT_EQ(-2, values[1]);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldReadTypedArraySizeWhenSizeFitToUint16)
+{
+	this->PrepareReader({ '\xC8', '\x00', '\x09', '\x10', '\x24', 0, 0, 0, 0, 0, 0, '\xF8', '\x3F' });
+	size_t size = 0;
+	auto itemType = BitSerializer::MsgPack::Detail::TypedArrayItemType::None;
+
+	ASSERT_TRUE(this->mMsgPackReader->ReadArraySize(size, itemType));
+	EXPECT_EQ(1U, size);
+	EXPECT_EQ(BitSerializer::MsgPack::Detail::TypedArrayItemType::Double, itemType);
+
+	double value = 0;
+	BitSerializer::MsgPack::Detail::ReadTypedArrayItems(*this->mMsgPackReader, &value, 1);
+	EXPECT_EQ(1.5, value);
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldReadSizeOfRegularArrayWhenTypedArrayIsAllowed)
+{
+	this->PrepareReader(MakeStringFromSequence(0b10011111));
+	size_t size = 0;
+	auto itemType = BitSerializer::MsgPack::Detail::TypedArrayItemType::Double;
+
+	ASSERT_TRUE(this->mMsgPackReader->ReadArraySize(size, itemType));
+	EXPECT_EQ(15U, size);
+	EXPECT_EQ(BitSerializer::MsgPack::Detail::TypedArrayItemType::None, itemType);
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadTypedArrayWithUnknownTypeOfItems)
+{
+	this->PrepareReader({ '\xC7', '\x03', '\x10', '\x35', '\x00', '\x00' });
+	size_t size = 0;
+	auto itemType = BitSerializer::MsgPack::Detail::TypedArrayItemType::None;
+	EXPECT_THROW(this->mMsgPackReader->ReadArraySize(size, itemType), BitSerializer::ParsingException);
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadTypedArrayWithInvalidSize)
+{
+	this->PrepareReader({ '\xC7', '\x04', '\x10', '\x13', '\x00', '\x00', '\x00' });
+	size_t size = 0;
+	auto itemType = BitSerializer::MsgPack::Detail::TypedArrayItemType::None;
+	EXPECT_THROW(this->mMsgPackReader->ReadArraySize(size, itemType), BitSerializer::ParsingException);
+}
+
 TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadFixedArrayToWrongType)
 {
 	this->PrepareReader(MakeStringFromSequence(0b10010010, '\xC2', '\xC3'));
@@ -743,6 +886,34 @@ TYPED_TEST(MsgPackReaderTest, ShouldReadBinaryArrayWhenUnexpectedEnd)
 	EXPECT_THROW(this->mMsgPackReader->ReadBinary(), BitSerializer::ParsingException);
 }
 
+TYPED_TEST(MsgPackReaderTest, ShouldReadBinaryArrayAsBlock)
+{
+	const auto expectedStr = this->GenTestString(std::numeric_limits<uint16_t>::max() + 3);
+	this->PrepareReader(std::string({ '\xC6', '\x00', '\x01', '\x00', '\x02' }) + expectedStr);
+
+	size_t actualSize = 3;
+	EXPECT_TRUE(this->mMsgPackReader->ReadBinarySize(actualSize));
+	ASSERT_EQ(expectedStr.size(), actualSize);
+	std::string actualStr(actualSize, '\0');
+	this->mMsgPackReader->ReadBinary(actualStr.data(), actualStr.size());
+	EXPECT_EQ(expectedStr, actualStr);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadBinaryBlockAfterEnd)
+{
+	this->PrepareReader(std::string({ '\xC4', '\x03', '\x01', '\x02' }));
+
+	// The reader from string checks the declared size against the size of input, others throw when reading the block
+	EXPECT_THROW({
+		size_t actualSize = 0;
+		char buffer[3];
+		if (this->mMsgPackReader->ReadBinarySize(actualSize)) {
+			this->mMsgPackReader->ReadBinary(buffer, actualSize);
+		}
+	}, BitSerializer::ParsingException);
+}
+
 TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadBinaryArrayToWrongType)
 {
 	this->PrepareReader({ '\xC4', '\x03', '\x01', '\x02', '\x03' });
@@ -1612,3 +1783,94 @@ TYPED_TEST(MsgPackReaderTest, ShouldSkipMapWhenSizeFitToUint32)
 	EXPECT_TRUE(this->mMsgPackReader->ReadValue(value));
 	ASSERT_EQ(true, value);
 }
+
+TYPED_TEST(MsgPackReaderTest, ShouldSkipNestedArraysAndMaps)
+{
+	// [ { "a": [1, "xy"], "b": {} }, [], [[true]] ]
+	this->PrepareReader({ '\x93',
+		'\x82', '\xA1', 'a', '\x92', '\x01', '\xA2', 'x', 'y', '\xA1', 'b', '\x80',
+		'\x90',
+		'\x91', '\x91', '\xC3',
+		'\xC2'
+	});
+
+	bool value = true;
+	this->mMsgPackReader->SkipValue();
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(value));
+	EXPECT_FALSE(value);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldSkipDeeplyNestedArrays)
+{
+	constexpr size_t nestingLevel = 1000000;
+	std::string data(nestingLevel, '\x91');
+	data += '\xC0';
+	data += '\xC3';
+	this->PrepareReader(std::move(data));
+
+	bool value{};
+	this->mMsgPackReader->SkipValue();
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(value));
+	EXPECT_TRUE(value);
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenSkipArrayWithUnexpectedEnd)
+{
+	this->PrepareReader({ '\x93', '\x01', '\x82', '\xA1', 'a', '\x02' });
+	EXPECT_THROW(this->mMsgPackReader->SkipValue(), BitSerializer::ParsingException);
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenSkipStringWithUnexpectedEnd)
+{
+	this->PrepareReader({ '\x91', '\xA5', 'a', 'b' });
+	EXPECT_THROW(this->mMsgPackReader->SkipValue(), BitSerializer::ParsingException);
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldReadIntegersOfAllSizesInSequence)
+{
+	// The last values are read when less than 8 bytes remain in the input data
+	this->PrepareReader({
+		'\xD3', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\x85',
+		'\xCF', '\x7F', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF',
+		'\xD2', '\x80', '\x00', '\x00', '\x00',
+		'\xCE', '\xFF', '\xFF', '\xFF', '\xFE',
+		'\xD1', '\xFF', '\x85',
+		'\xCD', '\x12', '\x34',
+		'\xD0', '\x80',
+		'\xCC', '\xFF'
+	});
+
+	int64_t i64 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(i64));
+	EXPECT_EQ(-123, i64);
+	uint64_t u64 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(u64));
+	EXPECT_EQ(static_cast<uint64_t>(std::numeric_limits<int64_t>::max()), u64);
+	int32_t i32 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(i32));
+	EXPECT_EQ(std::numeric_limits<int32_t>::min(), i32);
+	uint32_t u32 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(u32));
+	EXPECT_EQ(0xFFFFFFFEu, u32);
+	int16_t i16 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(i16));
+	EXPECT_EQ(-123, i16);
+	uint16_t u16 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(u16));
+	EXPECT_EQ(0x1234, u16);
+	int8_t i8 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(i8));
+	EXPECT_EQ(std::numeric_limits<int8_t>::min(), i8);
+	uint8_t u8 = 0;
+	EXPECT_TRUE(this->mMsgPackReader->ReadValue(u8));
+	EXPECT_EQ(255, u8);
+	EXPECT_TRUE(this->mMsgPackReader->IsEnd());
+}
+
+TYPED_TEST(MsgPackReaderTest, ShouldThrowExceptionWhenReadIntegerWithUnexpectedEnd)
+{
+	this->PrepareReader({ '\xD2', '\x01', '\x02', '\x03' });
+	int32_t value = 0;
+	EXPECT_THROW(this->mMsgPackReader->ReadValue(value), BitSerializer::ParsingException);
+}
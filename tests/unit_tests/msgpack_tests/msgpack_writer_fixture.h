@@ -5,8 +5,9 @@
 #pragma once
 #include <memory>
 #include <variant>
+#include <vector>
 #include "gtest/gtest.h"
-#include "msgpack/msgpack_writers.h"
+#include "bitserializer/msgpack_archive.h"
 
 template <class TWriter>
 class MsgPackWriterTest : public ::testing::Test
@@ -17,17 +18,24 @@ public:
 		if constexpr (std::is_same_v<TWriter, BitSerializer::MsgPack::Detail::CMsgPackStringWriter>)
 		{
 			mResult = std::string();
-			mMsgPackWriter = std::make_shared<TWriter>(std::get<std::string>(mResult));
+			mMsgPackWriter = std::make_shared<TWriter>(std::get<std::string>(mResult), mSerializationOptions);
 		}
 		else if constexpr (std::is_same_v<TWriter, BitSerializer::MsgPack::Detail::CMsgPackStreamWriter>)
 		{
 			mResult = std::ostringstream();
-			mMsgPackWriter = std::make_shared<TWriter>(std::get<std::ostringstream>(mResult));
+			mMsgPackWriter = std::make_shared<TWriter>(std::get<std::ostringstream>(mResult), mSerializationOptions);
+		}
+		else if constexpr (std::is_same_v<TWriter, BitSerializer::MsgPack::Detail::CMsgPackBufferWriter>)
+		{
+			mBufferData.resize(BufferCapacity);
+			mResult = BitSerializer::FixedOutputBuffer(mBufferData.data(), mBufferData.size());
+			mMsgPackWriter = std::make_shared<TWriter>(std::get<BitSerializer::FixedOutputBuffer>(mResult), mSerializationOptions);
 		}
 	}
 
 	std::string TakeResult()
 	{
+		mMsgPackWriter->Flush();
 		return std::visit([](auto&& arg)
 		{
 			using T = std::decay_t<decltype(arg)>;
@@ -43,6 +51,13 @@ public:
 				arg.str("");
 				return s;
 			}
+			else if constexpr (std::is_same_v<T, BitSerializer::FixedOutputBuffer>)
+			{
+				EXPECT_FALSE(arg.overflowed());
+				std::string s(arg.view());
+				arg.clear();
+				return s;
+			}
 		}, mResult);
 	}
 
@@ -61,6 +76,10 @@ public:
 	}
 
 protected:
+	static constexpr size_t BufferCapacity = 1024 * 1024;
+
+	BitSerializer::SerializationOptions mSerializationOptions;
+	std::vector<char> mBufferData;
+	std::variant<std::string, std::ostringstream, BitSerializer::FixedOutputBuffer> mResult;
 	std::shared_ptr<TWriter> mMsgPackWriter;
-	std::variant<std::string, std::ostringstream> mResult;
 };
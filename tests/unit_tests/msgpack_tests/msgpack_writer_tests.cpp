@@ -9,7 +9,8 @@
 
 
 using testing::Types;
-typedef Types<BitSerializer::MsgPack::Detail::CMsgPackStringWriter, BitSerializer::MsgPack::Detail::CMsgPackStreamWriter> Implementations;
+typedef Types<BitSerializer::MsgPack::Detail::CMsgPackStringWriter, BitSerializer::MsgPack::Detail::CMsgPackStreamWriter,
+	BitSerializer::MsgPack::Detail::CMsgPackBufferWriter> Implementations;
 
 // Tests for all implementations of IMsgPackWriter
 TYPED_TEST_SUITE(MsgPackWriterTest, Implementations, );
@@ -178,6 +179,44 @@ TYPED_TEST(MsgPackWriterTest, ShouldWriteDouble)
 	EXPECT_EQ("\xCB\x40\x09\x21\xFB\x54\x52\x45\x50", this->TakeResult());
 }
 
+//-----------------------------------------------------------------------------
+// Tests of writing sequences of numbers
+//-----------------------------------------------------------------------------
+TYPED_TEST(MsgPackWriterTest, ShouldWriteSequenceOfFloats)
+{
+	const float values[] = { 3.14f, 3.14f };
+	this->mMsgPackWriter->WriteValues(values, std::size(values));
+	EXPECT_EQ("\xCA\x40\x48\xF5\xC3\xCA\x40\x48\xF5\xC3", this->TakeResult());
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteSequenceOfDoubles)
+{
+	const double values[] = { 3.141592654 };
+	this->mMsgPackWriter->WriteValues(values, std::size(values));
+	EXPECT_EQ("\xCB\x40\x09\x21\xFB\x54\x52\x45\x50", this->TakeResult());
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteSequenceOfIntegersInShortestFormat)
+{
+	const int32_t values[] = { 1, -32, -33, 200, std::numeric_limits<int32_t>::min() };
+	this->mMsgPackWriter->WriteValues(values, std::size(values));
+	EXPECT_EQ(std::string({ '\x01', '\xE0', '\xD0', '\xDF', '\xD1', '\x00', '\xC8', '\xD2', '\x80', '\x00', '\x00', '\x00' }), this->TakeResult());
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteSequenceOfUnsignedIntegersInShortestFormat)
+{
+	const uint64_t values[] = { 1, 200, 300, std::numeric_limits<uint64_t>::max() };
+	this->mMsgPackWriter->WriteValues(values, std::size(values));
+	EXPECT_EQ(std::string({ '\x01', '\xCC', '\xC8', '\xCD', '\x01', '\x2C',
+		'\xCF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF', '\xFF' }), this->TakeResult());
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteEmptySequenceOfNumbers)
+{
+	this->mMsgPackWriter->WriteValues(static_cast<const int16_t*>(nullptr), 0);
+	EXPECT_TRUE(this->TakeResult().empty());
+}
+
 //-----------------------------------------------------------------------------
 // Tests of writing strings
 //-----------------------------------------------------------------------------
@@ -269,6 +308,30 @@ TYPED_TEST(MsgPackWriterTest, ShouldWriteArrayWhenSizeFitToUint32)
 	EXPECT_EQ(expectedStr, this->TakeResult());
 }
 
+TYPED_TEST(MsgPackWriterTest, ShouldWriteTypedArrayWhenSizeFitToUint8)
+{
+	const int16_t values[] = { 0x0102, -2 };
+	const std::string expectedStr = { '\xC7', '\x05', '\x10', '\x12', '\x02', '\x01', '\xFE', '\xFF' };
+	this->mMsgPackWriter->BeginTypedArray(BitSerializer::MsgPack::Detail::TypedArrayItemType::Int16, std::size(values));
+	BitSerializer::MsgPack::Detail::WriteTypedArrayItems(*this->mMsgPackWriter, values, std::size(values));
+	EXPECT_EQ(expectedStr, this->TakeResult());
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteTypedArrayWhenSizeFitToUint16)
+{
+	const std::vector<double> values(1000, 1.5);
+	this->mMsgPackWriter->BeginTypedArray(BitSerializer::MsgPack::Detail::TypedArrayItemType::Double, values.size());
+	const std::string expectedHeader = { '\xC8', '\x1F', '\x41', '\x10', '\x24' };
+	EXPECT_EQ(expectedHeader, this->TakeResult());
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteTypedArrayWhenSizeFitToUint32)
+{
+	this->mMsgPackWriter->BeginTypedArray(BitSerializer::MsgPack::Detail::TypedArrayItemType::UInt8, std::numeric_limits<uint16_t>::max());
+	const std::string expectedHeader = { '\xC9', '\x00', '\x01', '\x00', '\x00', '\x10', '\x01' };
+	EXPECT_EQ(expectedHeader, this->TakeResult());
+}
+
 //-----------------------------------------------------------------------------
 // Tests of writing binary arrays
 //-----------------------------------------------------------------------------
@@ -314,6 +377,15 @@ TYPED_TEST(MsgPackWriterTest, ShouldWriteBinaryArrayWhenSizeFitToUint32)
 	EXPECT_EQ(expectedStr, result);
 }
 
+TYPED_TEST(MsgPackWriterTest, ShouldWriteBinaryArrayAsBlock)
+{
+	const std::string testStr = this->GenTestString(std::numeric_limits<uint16_t>::max() + 3);
+	const auto expectedStr = std::string({ '\xC6', '\x00', '\x01', '\x00', '\x02' }) + testStr;
+	this->mMsgPackWriter->BeginBinary(testStr.size());
+	this->mMsgPackWriter->WriteBinary(testStr.data(), testStr.size());
+	EXPECT_EQ(expectedStr, this->TakeResult());
+}
+
 //-----------------------------------------------------------------------------
 // Tests of writing maps
 //-----------------------------------------------------------------------------
@@ -349,6 +421,47 @@ TYPED_TEST(MsgPackWriterTest, ShouldWriteMapWhenSizeFitToUint32)
 	EXPECT_EQ(expectedStr, this->TakeResult());
 }
 
+TYPED_TEST(MsgPackWriterTest, ShouldWriteMapWithUnknownSizeWhenSizeLessThan16)
+{
+	if constexpr (!TypeParam::require_map_size)
+	{
+		const std::string expectedStr = { '\x80', '\x82', '\x01', '\x02', '\x03', '\x04', '\x05' };
+		this->mMsgPackWriter->BeginMap(0);
+		const size_t headerPos = this->mMsgPackWriter->BeginMapWithUnknownSize();
+		for (uint8_t i = 1; i <= 4; ++i) {
+			this->mMsgPackWriter->WriteValue(i);
+		}
+		this->mMsgPackWriter->EndMapWithUnknownSize(headerPos, 2);
+		this->mMsgPackWriter->WriteValue(uint8_t(5));
+		EXPECT_EQ(expectedStr, this->TakeResult());
+	}
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteMapWithUnknownSizeWhenSizeFitToUint16)
+{
+	if constexpr (!TypeParam::require_map_size)
+	{
+		constexpr size_t mapSize = std::numeric_limits<uint16_t>::max();
+		const std::string expectedStr = { '\xDE', '\xFF', '\xFF', '\x01' };
+		const size_t headerPos = this->mMsgPackWriter->BeginMapWithUnknownSize();
+		this->mMsgPackWriter->WriteValue(uint8_t(1));
+		this->mMsgPackWriter->EndMapWithUnknownSize(headerPos, mapSize);
+		EXPECT_EQ(expectedStr, this->TakeResult());
+	}
+}
+
+TYPED_TEST(MsgPackWriterTest, ShouldWriteMapWithUnknownSizeWhenSizeFitToUint32)
+{
+	if constexpr (!TypeParam::require_map_size)
+	{
+		constexpr size_t mapSize = std::numeric_limits<uint16_t>::max() + 1;
+		const std::string expectedStr = { '\xDF', '\x00', '\x01', '\x00', '\x00' };
+		const size_t headerPos = this->mMsgPackWriter->BeginMapWithUnknownSize();
+		this->mMsgPackWriter->EndMapWithUnknownSize(headerPos, mapSize);
+		EXPECT_EQ(expectedStr, this->TakeResult());
+	}
+}
+
 //-----------------------------------------------------------------------------
 // Tests of writing timestamps
 //-----------------------------------------------------------------------------
@@ -372,3 +485,86 @@ TYPED_TEST(MsgPackWriterTest, ShouldWriteTimestamp96)
 	this->mMsgPackWriter->WriteValue(timeSpec);
 	EXPECT_EQ("\xC7\x0C\xFF\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C", this->TakeResult());
 }
+
+//-----------------------------------------------------------------------------
+// Tests of buffering in the stream writer
+//-----------------------------------------------------------------------------
+TEST(MsgPackStreamWriterTest, ShouldWriteToStreamWhenBufferIsFull)
+{
+	BitSerializer::SerializationOptions serializationOptions;
+	serializationOptions.streamOptions.writeBufferSize = 8;
+	std::ostringstream outputStream;
+	BitSerializer::MsgPack::Detail::CMsgPackStreamWriter msgPackWriter(outputStream, serializationOptions);
+
+	msgPackWriter.WriteValue(true);
+	msgPackWriter.WriteValue(static_cast<uint16_t>(1000));
+	EXPECT_TRUE(outputStream.str().empty());
+
+	msgPackWriter.WriteValue(static_cast<uint32_t>(100000));
+	EXPECT_EQ(std::string({ '\xC3', '\xCD', '\x03', '\xE8', '\xCE', '\x00', '\x01', '\x86', '\xA0' }), outputStream.str());
+
+	msgPackWriter.WriteValue(false);
+	msgPackWriter.Flush();
+	EXPECT_EQ(std::string({ '\xC3', '\xCD', '\x03', '\xE8', '\xCE', '\x00', '\x01', '\x86', '\xA0', '\xC2' }), outputStream.str());
+}
+
+TEST(MsgPackStreamWriterTest, ShouldFlushBufferInDestructor)
+{
+	std::ostringstream outputStream;
+	{
+		BitSerializer::MsgPack::Detail::CMsgPackStreamWriter msgPackWriter(outputStream, BitSerializer::SerializationOptions());
+		msgPackWriter.WriteValue("test");
+		EXPECT_TRUE(outputStream.str().empty());
+	}
+	EXPECT_EQ(std::string({ '\xA4', 't', 'e', 's', 't' }), outputStream.str());
+}
+
+//-----------------------------------------------------------------------------
+TEST(MsgPackSizeWriterTest, ShouldCalculateSameSizeAsStringWriter)
+{
+	using namespace BitSerializer::MsgPack::Detail;
+	const BitSerializer::SerializationOptions serializationOptions;
+	std::string outputString;
+	CMsgPackStringWriter stringWriter(outputString, serializationOptions);
+	size_t outputSize = 0;
+	CMsgPackSizeWriter sizeWriter(outputSize, serializationOptions);
+	const auto writeToBoth = [&](auto&& writeFn)
+	{
+		writeFn(stringWriter);
+		writeFn(sizeWriter);
+		EXPECT_EQ(outputString.size(), outputSize);
+	};
+
+	writeToBoth([](auto& writer) { writer.WriteValue(nullptr); writer.WriteValue(true); });
+	for (const uint64_t value : { 0ull, 127ull, 128ull, 255ull, 256ull, 65535ull, 65536ull, 4294967295ull, 4294967296ull })
+	{
+		writeToBoth([value](auto& writer) { writer.WriteValue(value); });
+		writeToBoth([value](auto& writer) { writer.WriteValue(static_cast<uint8_t>(value)); });
+		writeToBoth([value](auto& writer) { writer.WriteValue(static_cast<uint16_t>(value)); });
+		writeToBoth([value](auto& writer) { writer.WriteValue(static_cast<uint32_t>(value)); });
+	}
+	for (const int64_t value : { 0ll, 127ll, 128ll, -32ll, -33ll, -128ll, -129ll, 32767ll, -32769ll, 2147483647ll, -2147483649ll })
+	{
+		writeToBoth([value](auto& writer) { writer.WriteValue(value); });
+		writeToBoth([value](auto& writer) { writer.WriteValue(static_cast<int8_t>(value)); });
+		writeToBoth([value](auto& writer) { writer.WriteValue(static_cast<int16_t>(value)); });
+		writeToBoth([value](auto& writer) { writer.WriteValue(static_cast<int32_t>(value)); });
+	}
+	writeToBoth([](auto& writer) { writer.WriteValue(1.5f); writer.WriteValue(2.5); });
+	for (const size_t size : { 0, 31, 32, 255, 256, 65535, 65536 })
+	{
+		const std::string str(size, 'x');
+		writeToBoth([&str](auto& writer) { writer.WriteValue(std::string_view(str)); });
+		writeToBoth([size](auto& writer) { writer.BeginArray(size); writer.BeginMap(size); writer.BeginBinary(size); });
+		writeToBoth([size](auto& writer) { writer.BeginTypedArray(TypedArrayItemType::Int16, size); });
+		writeToBoth([size](auto& writer) { writer.EndMapWithUnknownSize(writer.BeginMapWithUnknownSize(), size); });
+	}
+	for (const int64_t seconds : { 0ll, 1ll << 33, 1ll << 34, -1ll })
+	{
+		writeToBoth([seconds](auto& writer) { writer.WriteValue(BitSerializer::Detail::CBinTimestamp(seconds, 0)); });
+		writeToBoth([seconds](auto& writer) { writer.WriteValue(BitSerializer::Detail::CBinTimestamp(seconds, 999999999)); });
+	}
+	const std::array<int32_t, 6> numbers = { 0, -33, 200, -40000, 70000, std::numeric_limits<int32_t>::min() };
+	writeToBoth([&numbers](auto& writer) { writer.WriteValues(numbers.data(), numbers.size()); });
+	writeToBoth([](auto& writer) { writer.WriteBinary('x'); writer.WriteBinary("test", 4); });
+}